@@ -8,6 +8,7 @@
 #include "type.hpp"      // Definition des Typsystems (ast::Type)
 #include "function.hpp"  // Definition von Funktionsparametern (ast::Param)
 #include "stmt.hpp"      // Definition von Statement-AST-Knoten (StmtPtr)
+#include "location.hpp"  // SourceLoc
 
 namespace ast {
 
@@ -15,6 +16,7 @@ namespace ast {
 struct FieldDecl {
     Type type;           // Typ des Feldes
     std::string name;    // Name des Feldes
+    SourceLoc loc;       // Position des Feldnamens
 };
 
 // Beschreibt eine Methode innerhalb einer Klasse
@@ -24,6 +26,7 @@ struct MethodDef {
     Type return_type;                  // Rueckgabetyp der Methode
     std::vector<ast::Param> params;    // Parameterliste der Methode
     StmtPtr body;                      // Methodenrumpf als AST
+    SourceLoc loc;                     // Position des Methodennamens
 };
 
 // Beschreibt einen Konstruktor einer Klasse
@@ -31,6 +34,7 @@ struct MethodDef {
 struct ConstructorDef {
     std::vector<ast::Param> params;    // Parameterliste des Konstruktors
     StmtPtr body;                      // Konstruktor-Rumpf als AST
+    SourceLoc loc;                     // Position des Konstruktornamens
 };
 
 // Beschreibt eine komplette Klassendefinition im AST
@@ -41,6 +45,8 @@ struct ClassDef {
     std::vector<FieldDecl> fields;     // Alle Felder der Klasse
     std::vector<ConstructorDef> ctors; // Alle Konstruktoren der Klasse
     std::vector<MethodDef> methods;    // Alle Methoden der Klasse
+
+    SourceLoc loc;                     // Position des Klassennamens
 };
 
 } // namespace ast
@@ -5,10 +5,32 @@
 #include <string>   // std::string
 #include <vector>   // std::vector
 
+#include "location.hpp" // SourceLoc
+#include "type.hpp"     // Type (statischer Typ aus der semantischen Analyse)
+
 namespace ast {
 
 // Basisklasse aller Ausdrucks-Knoten im AST
 struct Expr {
+    SourceLoc loc;             // Position im Quelltext (Operator bzw. erstes Token)
+
+    // Von sem::Analyzer eingetragen: Basistyp (ohne &) des Ergebnisses.
+    // typed == true => primitive Werte haben zur Laufzeit garantiert diesen Typ.
+    Type static_type;
+    bool typed = false;
+
+    // Von den opt-Durchläufen gesetzt: Knoten ist ein spezialisierter Interpreter-Knoten
+    // und wird vor jeder dynamic_cast-Kette ausgewertet
+    enum class Specialised : unsigned char {
+        No,
+        Binary,  // interp::SpecialisedBinary (opt::specialise_binaries, Superinstruktionen)
+        Assign,  // interp::FusedAssign (opt::fuse_superinstructions)
+        Inline,  // interp::InlineNode (Parameter/Felder in Inline-Rümpfen, opt::inline_calls)
+        InlinedCall,   // interp::InlinedCall
+        InlinedMethod  // interp::InlinedMethodCall
+    };
+    Specialised specialised = Specialised::No;
+
     virtual ~Expr() = default; // Virtueller Destruktor fuer polymorphe Nutzung
 };
 
@@ -7,6 +7,7 @@
 
 #include "stmt.hpp" // Definition von Statement-AST-Knoten (Stmt)
 #include "type.hpp" // Definition des Typsystems (Type)
+#include "location.hpp" // SourceLoc
 
 namespace ast {
 
@@ -22,6 +23,7 @@ struct FunctionDef {
     Type return_type;                // Rueckgabetyp der Funktion
     std::vector<Param> params;       // Parameterliste der Funktion
     std::unique_ptr<Stmt> body;      // Funktionsrumpf als Statement-AST
+    SourceLoc loc;                   // Position des Funktionsnamens
 };
 
 } // namespace ast
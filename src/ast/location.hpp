@@ -0,0 +1,16 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+namespace ast {
+
+// Quellposition eines AST-Knotens (Startzeile/-spalte, 1-based; 0 => unbekannt).
+// Bewusst nur der Anfang: Fehlermeldungen und Profile nennen die Startposition eines
+// Statements, ein Ende würde jeden Knoten vergrößern, ohne dass es jemand liest.
+struct SourceLoc {
+    int line = 0;   // Zeile
+    int col = 0;    // Spalte
+
+    bool known() const { return line > 0; }
+};
+
+} // namespace ast
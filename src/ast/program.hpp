@@ -1,7 +1,7 @@
 #pragma once
 // Verhindert mehrfaches Einbinden dieser Header-Datei
 
-#include <vector>   // std::vector
+#include <deque>    // std::deque (stabile Adressen beim Anhängen)
 
 #include "function.hpp" // Definition von FunctionDef
 #include "class.hpp"    // Definition von ClassDef
@@ -9,9 +9,11 @@
 namespace ast {
 
 // Wurzelknoten des AST: gesamtes Programm
+// deque statt vector: die Runtime-Tabellen halten Pointer auf Definitionen,
+// die beim Anhängen neuer Definitionen (REPL) gültig bleiben müssen.
 struct Program {
-    std::vector<ClassDef> classes;       // Alle Klassendefinitionen im Programm
-    std::vector<FunctionDef> functions;  // Alle freien Funktionsdefinitionen
+    std::deque<ClassDef> classes;       // Alle Klassendefinitionen im Programm
+    std::deque<FunctionDef> functions;  // Alle freien Funktionsdefinitionen
 };
 
 } // namespace ast
@@ -7,11 +7,14 @@
 #include <string>    // std::string
 
 #include "type.hpp"  // Definition des Typsystems (Type)
+#include "location.hpp" // SourceLoc
 
 namespace ast {
 
 // Basisklasse aller Statement-Knoten im AST
 struct Stmt {
+    SourceLoc loc;             // Position des ersten Tokens
+
     virtual ~Stmt() = default; // Virtueller Destruktor fuer polymorphe Nutzung
 };
 
@@ -21,6 +24,7 @@ using StmtPtr = std::unique_ptr<Stmt>;
 // Block von Statements: { stmt1; stmt2; ... }
 struct BlockStmt : Stmt {
     std::vector<StmtPtr> statements; // Sequenz von Statements im Block
+    bool frame_objects = false;      // deklariert Frame-Objekte (opt::mark_frame_objects)
 };
 
 struct Expr; // Forward-Deklaration, um zyklische Includes zu vermeiden
@@ -35,6 +39,7 @@ struct VarDeclStmt : Stmt {
     Type decl_type;                 // Deklarierter Typ der Variable (z.B. int, bool, T&, ...)
     std::string name;               // Name der Variable
     std::unique_ptr<Expr> init;     // Optionaler Initialisierer (kann null sein)
+    bool frame_object = false;      // Klassenobjekt liegt im Env statt auf dem Heap (opt::mark_frame_objects)
 };
 
 // If-Statement: if (cond) then_branch else else_branch
@@ -53,6 +58,7 @@ struct WhileStmt : Stmt {
 // Return-Statement: return expr;
 struct ReturnStmt : Stmt {
     std::unique_ptr<Expr> value; // Rueckgabewert (null bei void-return)
+    bool tail_call = false;      // value ist ein Aufruf in Tail-Position (opt::mark_tail_calls)
 };
 
 } // namespace ast
@@ -0,0 +1,585 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <memory>         // std::unique_ptr
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+#include "nodes.hpp"                  // Closure-Knoten
+#include "../ast/function.hpp"        // ast::FunctionDef
+#include "../ast/expr.hpp"            // AST: Expression-Knoten
+#include "../ast/stmt.hpp"            // AST: Statement-Knoten
+#include "../interp/lvalue.hpp"       // LValue (Argumente interpretierter Aufrufe)
+#include "../interp/functions.hpp"    // is_builtin
+#include "../interp/output.hpp"       // print_*-Builtins
+#include "../interp/input.hpp"        // read_*-Builtins
+#include "../interp/call_stack.hpp"   // CallScope (Schattenstack, --profile)
+#include "../interp/exec_options.hpp" // Tail-Calls, JIT an/aus
+#include "../interp/stats.hpp"        // Zähler (--stats)
+#include "../interp/memo.hpp"         // gecachte reine Funktionen (--memoize)
+#include "../jit/jit.hpp"             // JIT hat Vorrang vor der Closure-Engine
+
+namespace interp {
+// Aufruf einer freien Funktion über den Interpreter (definiert in exec.hpp)
+inline Value call_function(Env& caller_env,
+                           const ast::FunctionDef& f,
+                           const std::vector<Value>& arg_vals,
+                           const std::vector<LValue>& arg_lvals,
+                           FunctionTable& functions);
+} // namespace interp
+
+namespace closure {
+
+// Funktion (oder Teil davon) nicht übersetzbar => Baum-Interpreter
+struct Unsupported {};
+
+// Übersetzte Funktion: Rumpf als Closure-Baum, Parameter in den ersten Slots
+struct CompiledFunction {
+    const ast::FunctionDef* def = nullptr;
+    size_t params = 0;       // Anzahl Parameter (= erste Slots)
+    size_t slots = 0;        // Parameter + alle Locals
+    Located body;
+    Value fallback;          // Ergebnis ohne return (Default-Wert bzw. 0 bei void)
+
+    // args: params Werte, werden in die Slots verschoben.
+    // Tail-Calls laufen als Schleife: der Frame wird abgebaut und durch den des Ziels ersetzt.
+    Value call(Value* args, interp::Env& caller_env, interp::FunctionTable& functions) const {
+        const CompiledFunction* fn = this;
+        std::vector<Value> pending; // Argumente des laufenden Tail-Calls
+        const ast::FunctionDef* interpreted = nullptr;
+
+        for (;;) {
+            {
+                interp::CallScope scope(fn->def);
+
+                Value inline_slots[8];
+                std::vector<Value> many;
+                Value* s = inline_slots;
+                if (fn->slots > 8) {
+                    many.resize(fn->slots);
+                    s = many.data();
+                }
+                for (size_t i = 0; i < fn->params; ++i) s[i] = std::move(args[i]);
+
+                Frame frame{s, &caller_env, &functions};
+                Flow flow;
+                while ((flow = run_located(fn->body, frame)) == Flow::TailSelf) ++interp::stats().tail_calls;
+
+                if (flow == Flow::Return)
+                    return fn->def->return_type.base == ast::Type::Base::Void ? Value{0} : std::move(frame.result);
+                if (flow == Flow::Normal) return fn->fallback;
+
+                ++interp::stats().tail_calls;
+                pending = std::move(frame.tail_args);
+                args = pending.data();
+                if (!frame.tail_fn) interpreted = frame.tail_def;
+                else fn = frame.tail_fn;
+            }
+            // Ziel ohne Closure-Baum (JIT oder Baum-Interpreter): nach Abbau des Frames aufrufen
+            if (interpreted)
+                return interp::call_function(caller_env, *interpreted, pending,
+                                             std::vector<interp::LValue>(pending.size()), functions);
+        }
+    }
+
+    Value call(const std::vector<Value>& arg_vals, interp::Env& caller_env, interp::FunctionTable& functions) const {
+        std::vector<Value> args(arg_vals);
+        return call(args.data(), caller_env, functions);
+    }
+};
+
+// Übersetzte Funktion fuer f (nullptr => Baum-Interpreter); definiert unten
+inline const CompiledFunction* find_compiled(const ast::FunctionDef& f, interp::FunctionTable& functions);
+
+// Aufruf einer Skriptfunktion. Das Ziel steht zur Übersetzungszeit fest; ob es selbst
+// übersetzt ist, wird beim ersten Aufruf entschieden (erlaubt Rekursion ohne Vorab-Übersetzung).
+struct Call : Node<Value> {
+    const ast::FunctionDef* callee;
+    std::vector<NodePtr<Value>> args;
+    mutable bool linked = false;
+    mutable const CompiledFunction* target = nullptr; // nullptr => über den Interpreter (ggf. JIT)
+
+    explicit Call(const ast::FunctionDef* f) : Node<Value>(&run), callee(f) {}
+
+    // Übersetztes Ziel oder nullptr; der JIT hat Vorrang
+    const CompiledFunction* link(Frame& f) const {
+        if (!linked) {
+            const bool jitted = interp::exec_options().jit && jit::jit().find(*callee, *f.functions);
+            target = jitted ? nullptr : find_compiled(*callee, *f.functions);
+            linked = true;
+        }
+        return target;
+    }
+
+    static Value run(const Node<Value>* n, Frame& f) {
+        auto* self = static_cast<const Call*>(n);
+        const CompiledFunction* target = self->link(f);
+
+        const size_t count = self->args.size();
+        if (target) {
+            Value tmp[8];
+            std::vector<Value> many;
+            Value* vals = tmp;
+            if (count > 8) {
+                many.resize(count);
+                vals = many.data();
+            }
+            for (size_t i = 0; i < count; ++i) vals[i] = (*self->args[i])(f);
+            return target->call(vals, *f.env, *f.functions);
+        }
+
+        std::vector<Value> vals;
+        vals.reserve(count);
+        for (const auto& a : self->args) vals.push_back((*a)(f));
+        return interp::call_function(*f.env, *self->callee, vals, std::vector<interp::LValue>(count),
+                                     *f.functions);
+    }
+};
+
+// "return g(...);" auf eine andere Funktion: Argumente auswerten, Ziel im Frame ablegen
+struct TailCall : Node<Flow> {
+    std::unique_ptr<Call> call;
+    explicit TailCall(std::unique_ptr<Call> c) : Node<Flow>(&run), call(std::move(c)) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        const Call& c = *static_cast<const TailCall*>(n)->call;
+        f.tail_args.clear();
+        for (const auto& a : c.args) f.tail_args.push_back((*a)(f));
+        f.tail_fn = c.link(f);
+        f.tail_def = c.callee;
+        return Flow::TailCall;
+    }
+};
+
+// ---------- Builtins ----------
+
+inline void builtin_print_int(const int& v) { interp::output().write_int_line(v); }
+inline void builtin_print_bool(const bool& v) { interp::output().write_int_line(v ? 1 : 0); }
+inline void builtin_print_char(const char& v) { interp::output().write_char_line(v); }
+inline void builtin_print_string(const std::string& v) { interp::output().write_string_line(v); }
+inline int builtin_read_int() { return interp::input().read_int(); }
+inline char builtin_read_char() { return interp::input().read_char(); }
+inline std::string builtin_read_line() { return interp::input().read_line(); }
+inline bool builtin_has_input() { return interp::input().has_input(); }
+inline bool builtin_has_int() { return interp::input().has_int(); }
+
+// Übersetzer einer freien Funktion in einen Closure-Baum.
+// Voraussetzung sind die statischen Typen der semantischen Analyse (Expr::typed): ohne sie
+// (--no-sem, neue REPL-Definitionen) bleibt alles beim Baum-Interpreter.
+// Unterstützt: bool/int/char/string-Parameter und -Locals (keine Referenzen), Literale,
+// Variablen, Zuweisung, alle Operatoren, if/while/return, Builtins und Aufrufe freier Funktionen.
+class FunctionCompiler {
+public:
+    FunctionCompiler(const ast::FunctionDef& f, interp::FunctionTable& functions)
+        : f_(f), functions_(functions) {}
+
+    std::unique_ptr<CompiledFunction> compile() {
+        using Base = ast::Type::Base;
+        auto out = std::make_unique<CompiledFunction>();
+        out->def = &f_;
+
+        const Base ret = f_.return_type.base;
+        require(!f_.return_type.is_ref && ret != Base::Class);
+        out->fallback = ret == Base::Void ? Value{0} : default_value(f_.return_type);
+
+        scopes_.emplace_back();
+        for (const auto& p : f_.params) {
+            require(!p.type.is_ref && p.type.base != Base::Class && p.type.base != Base::Void);
+            declare(p.name, p.type.base);
+        }
+        out->params = f_.params.size();
+
+        if (!f_.body) throw Unsupported{};
+        out->body = located(*f_.body);
+        out->slots = slots_;
+        return out;
+    }
+
+private:
+    using Base = ast::Type::Base;
+
+    struct Var {
+        Base type;
+        size_t slot;
+    };
+
+    const ast::FunctionDef& f_;
+    interp::FunctionTable& functions_;
+    std::vector<std::unordered_map<std::string, Var>> scopes_;
+    size_t slots_ = 0;
+
+    static void require(bool ok) {
+        if (!ok) throw Unsupported{};
+    }
+
+    static Value default_value(const ast::Type& t) {
+        switch (t.base) {
+            case Base::Bool:   return Value{false};
+            case Base::Int:    return Value{0};
+            case Base::Char:   return Value{'\0'};
+            case Base::String: return Value{std::string()};
+            default:           throw Unsupported{};
+        }
+    }
+
+    template <class T>
+    static constexpr Base base_of() {
+        if constexpr (std::is_same_v<T, bool>) return Base::Bool;
+        else if constexpr (std::is_same_v<T, int>) return Base::Int;
+        else if constexpr (std::is_same_v<T, char>) return Base::Char;
+        else return Base::String;
+    }
+
+    size_t declare(const std::string& name, Base t) {
+        size_t slot = slots_++;
+        require(scopes_.back().emplace(name, Var{t, slot}).second);
+        return slot;
+    }
+
+    const Var& lookup(const std::string& name) const {
+        for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it) {
+            auto v = it->find(name);
+            if (v != it->end()) return v->second;
+        }
+        // Nicht lexikalisch sichtbar (z.B. Session-Variable im REPL) => Interpreter
+        throw Unsupported{};
+    }
+
+    // Statischer Basistyp eines Ausdrucks (von sem eingetragen)
+    static Base type_of(const ast::Expr& e) {
+        require(e.typed);
+        return e.static_type.base;
+    }
+
+    // ---------- Statements ----------
+
+    Located located(const ast::Stmt& s) { return Located{s.loc, stmt(s)}; }
+
+    StmtPtr stmt(const ast::Stmt& s) {
+        using namespace ast;
+
+        if (auto* b = dynamic_cast<const BlockStmt*>(&s)) {
+            auto block = std::make_unique<Block>();
+            scopes_.emplace_back();
+            for (const auto& st : b->statements) block->stmts.push_back(located(*st));
+            scopes_.pop_back();
+            return block;
+        }
+
+        if (auto* v = dynamic_cast<const VarDeclStmt*>(&s)) {
+            const Type& t = v->decl_type;
+            require(!t.is_ref);
+            if (v->init) require(type_of(*v->init) == t.base);
+            // Initialisierer sieht die neue Variable noch nicht (wie im Interpreter)
+            switch (t.base) {
+                case Base::Bool:   return declare_as<bool>(*v);
+                case Base::Int:    return declare_as<int>(*v);
+                case Base::Char:   return declare_as<char>(*v);
+                case Base::String: return declare_as<std::string>(*v);
+                default:           throw Unsupported{};
+            }
+        }
+
+        if (auto* e = dynamic_cast<const ExprStmt*>(&s))
+            return std::make_unique<Effect>(effect(*e->expr));
+
+        if (auto* i = dynamic_cast<const IfStmt*>(&s)) {
+            auto node = std::make_unique<If>();
+            node->cond = cond(*i->cond);
+            node->then_branch = sub_stmt(*i->then_branch);
+            if (i->else_branch) node->else_branch = sub_stmt(*i->else_branch);
+            return node;
+        }
+
+        if (auto* w = dynamic_cast<const WhileStmt*>(&s)) {
+            auto node = std::make_unique<While>();
+            node->cond = cond(*w->cond);
+            node->body = sub_stmt(*w->body);
+            return node;
+        }
+
+        if (auto* r = dynamic_cast<const ReturnStmt*>(&s)) {
+            if (!r->value) {
+                require(f_.return_type.base == Base::Void);
+                return std::make_unique<Return>(nullptr);
+            }
+            require(f_.return_type.base != Base::Void && type_of(*r->value) == f_.return_type.base);
+
+            // Tail-Call: auf sich selbst Parameter überschreiben und Rumpf neu starten,
+            // sonst den Frame in CompiledFunction::call durch den des Ziels ersetzen
+            auto* c = dynamic_cast<const CallExpr*>(r->value.get());
+            if (c && r->tail_call && interp::exec_options().tail_calls && !interp::is_builtin(c->callee)) {
+                std::vector<NodePtr<Value>> args;
+                const ast::FunctionDef* callee = resolve(*c, args);
+                if (callee == &f_) {
+                    auto node = std::make_unique<TailSelf>();
+                    node->args = std::move(args);
+                    return node;
+                }
+                auto call = std::make_unique<Call>(callee);
+                call->args = std::move(args);
+                return std::make_unique<TailCall>(std::move(call));
+            }
+            return std::make_unique<Return>(boxed(*r->value));
+        }
+
+        throw Unsupported{};
+    }
+
+    template <class T>
+    StmtPtr declare_as(const ast::VarDeclStmt& v) {
+        NodePtr<T> init = v.init ? expr<T>(*v.init) : nullptr;
+        return std::make_unique<Declare<T>>(declare(v.name, base_of<T>()), std::move(init));
+    }
+
+    // Rumpf von if/while: eine Deklaration ohne Block landete im umgebenden Scope
+    Located sub_stmt(const ast::Stmt& s) {
+        require(dynamic_cast<const ast::VarDeclStmt*>(&s) == nullptr);
+        return located(s);
+    }
+
+    // ---------- Ausdrücke ----------
+
+    // Ausdruck mit statisch bekanntem Typ T
+    template <class T>
+    NodePtr<T> expr(const ast::Expr& e) {
+        using namespace ast;
+        require(type_of(e) == base_of<T>());
+
+        if (auto* i = dynamic_cast<const IntLiteral*>(&e)) {
+            if constexpr (std::is_same_v<T, int>) return std::make_unique<Const<int>>(i->value);
+        }
+        if (auto* b = dynamic_cast<const BoolLiteral*>(&e)) {
+            if constexpr (std::is_same_v<T, bool>) return std::make_unique<Const<bool>>(b->value);
+        }
+        if (auto* c = dynamic_cast<const CharLiteral*>(&e)) {
+            if constexpr (std::is_same_v<T, char>) return std::make_unique<Const<char>>(c->value);
+        }
+        if (auto* s = dynamic_cast<const StringLiteral*>(&e)) {
+            if constexpr (std::is_same_v<T, std::string>) return std::make_unique<Const<std::string>>(s->value);
+        }
+
+        if (auto* v = dynamic_cast<const VarExpr*>(&e)) {
+            const Var& var = lookup(v->name);
+            require(var.type == base_of<T>());
+            return std::make_unique<Load<T>>(var.slot);
+        }
+        if (auto* a = dynamic_cast<const AssignExpr*>(&e)) {
+            NodePtr<T> value = expr<T>(*a->value);
+            const Var& var = lookup(a->name);
+            require(var.type == base_of<T>());
+            return std::make_unique<Store<T>>(var.slot, std::move(value));
+        }
+
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) {
+            if constexpr (std::is_same_v<T, int>) {
+                if (u->op == UnaryExpr::Op::Neg) return std::make_unique<Negate>(expr<int>(*u->expr));
+            }
+            if constexpr (std::is_same_v<T, bool>) {
+                if (u->op == UnaryExpr::Op::Not) return std::make_unique<Not>(expr<bool>(*u->expr));
+            }
+            throw Unsupported{};
+        }
+
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
+            if constexpr (std::is_same_v<T, int>) return arithmetic(*b);
+            if constexpr (std::is_same_v<T, bool>) return logical(*b);
+            throw Unsupported{};
+        }
+
+        if (auto* c = dynamic_cast<const CallExpr*>(&e)) {
+            if (interp::is_builtin(c->callee)) return input<T>(*c);
+            std::vector<NodePtr<Value>> args;
+            auto call = std::make_unique<Call>(resolve(*c, args));
+            call->args = std::move(args);
+            return std::make_unique<Unbox<T>>(std::move(call));
+        }
+
+        throw Unsupported{};
+    }
+
+    NodePtr<int> arithmetic(const ast::BinaryExpr& b) {
+        using Op = ast::BinaryExpr::Op;
+        NodePtr<int> l = expr<int>(*b.left);
+        NodePtr<int> r = expr<int>(*b.right);
+        switch (b.op) {
+            case Op::Add: return std::make_unique<Binary<int, int, OpAdd>>(std::move(l), std::move(r));
+            case Op::Sub: return std::make_unique<Binary<int, int, OpSub>>(std::move(l), std::move(r));
+            case Op::Mul: return std::make_unique<Binary<int, int, OpMul>>(std::move(l), std::move(r));
+            case Op::Div: return std::make_unique<Binary<int, int, OpDiv>>(std::move(l), std::move(r));
+            case Op::Mod: return std::make_unique<Binary<int, int, OpMod>>(std::move(l), std::move(r));
+            default:      throw Unsupported{};
+        }
+    }
+
+    NodePtr<bool> logical(const ast::BinaryExpr& b) {
+        using Op = ast::BinaryExpr::Op;
+        switch (b.op) {
+            case Op::AndAnd: return std::make_unique<And>(cond(*b.left), cond(*b.right));
+            case Op::OrOr:   return std::make_unique<Or>(cond(*b.left), cond(*b.right));
+            default: break;
+        }
+        switch (type_of(*b.left)) {
+            case Base::Int:    return compare<int>(b);
+            case Base::Char:   return compare<char>(b);
+            case Base::Bool:   return compare<bool>(b);
+            case Base::String: return compare<std::string>(b);
+            default:           throw Unsupported{};
+        }
+    }
+
+    // Vergleich zweier Operanden vom Typ T (<, <=, >, >= nur fuer int/char)
+    template <class T>
+    NodePtr<bool> compare(const ast::BinaryExpr& b) {
+        using Op = ast::BinaryExpr::Op;
+        NodePtr<T> l = expr<T>(*b.left);
+        NodePtr<T> r = expr<T>(*b.right);
+        switch (b.op) {
+            case Op::Eq: return std::make_unique<Binary<T, bool, OpEq>>(std::move(l), std::move(r));
+            case Op::Ne: return std::make_unique<Binary<T, bool, OpNe>>(std::move(l), std::move(r));
+            default: break;
+        }
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, char>) {
+            switch (b.op) {
+                case Op::Lt: return std::make_unique<Binary<T, bool, OpLt>>(std::move(l), std::move(r));
+                case Op::Le: return std::make_unique<Binary<T, bool, OpLe>>(std::move(l), std::move(r));
+                case Op::Gt: return std::make_unique<Binary<T, bool, OpGt>>(std::move(l), std::move(r));
+                case Op::Ge: return std::make_unique<Binary<T, bool, OpGe>>(std::move(l), std::move(r));
+                default: break;
+            }
+        }
+        throw Unsupported{};
+    }
+
+    // Bedingung (if/while/&&/||): int/char/string wie to_bool_like_cpp
+    NodePtr<bool> cond(const ast::Expr& e) {
+        switch (type_of(e)) {
+            case Base::Bool:   return expr<bool>(e);
+            case Base::Int:    return std::make_unique<Truth<int>>(expr<int>(e));
+            case Base::Char:   return std::make_unique<Truth<char>>(expr<char>(e));
+            case Base::String: return std::make_unique<Truth<std::string>>(expr<std::string>(e));
+            default:           throw Unsupported{};
+        }
+    }
+
+    // Ausdruck als Value (Argumente, Rückgabewerte)
+    NodePtr<Value> boxed(const ast::Expr& e) {
+        switch (type_of(e)) {
+            case Base::Bool:   return std::make_unique<Box<bool>>(expr<bool>(e));
+            case Base::Int:    return std::make_unique<Box<int>>(expr<int>(e));
+            case Base::Char:   return std::make_unique<Box<char>>(expr<char>(e));
+            case Base::String: return std::make_unique<Box<std::string>>(expr<std::string>(e));
+            default:           throw Unsupported{};
+        }
+    }
+
+    // Ausdrucksstatement: Ergebnis wird verworfen (auch void-Aufrufe)
+    NodePtr<void> effect(const ast::Expr& e) {
+        if (auto* c = dynamic_cast<const ast::CallExpr*>(&e)) {
+            const std::string& n = c->callee;
+            if (n == "print_int")    return output<int>(*c, &builtin_print_int);
+            if (n == "print_bool")   return output<bool>(*c, &builtin_print_bool);
+            if (n == "print_char")   return output<char>(*c, &builtin_print_char);
+            if (n == "print_string") return output<std::string>(*c, &builtin_print_string);
+            if (!interp::is_builtin(n) && type_of(e) == Base::Void) {
+                std::vector<NodePtr<Value>> args;
+                auto call = std::make_unique<Call>(resolve(*c, args));
+                call->args = std::move(args);
+                return std::make_unique<Discard<Value>>(std::move(call));
+            }
+        }
+        switch (type_of(e)) {
+            case Base::Bool:   return std::make_unique<Discard<bool>>(expr<bool>(e));
+            case Base::Int:    return std::make_unique<Discard<int>>(expr<int>(e));
+            case Base::Char:   return std::make_unique<Discard<char>>(expr<char>(e));
+            case Base::String: return std::make_unique<Discard<std::string>>(expr<std::string>(e));
+            default:           throw Unsupported{};
+        }
+    }
+
+    template <class T>
+    NodePtr<void> output(const ast::CallExpr& c, void (*write)(const T&)) {
+        require(c.args.size() == 1);
+        return std::make_unique<Output<T>>(write, expr<T>(*c.args[0]));
+    }
+
+    // Parameterlose Builtins (read_*, has_*)
+    template <class T>
+    NodePtr<T> input(const ast::CallExpr& c) {
+        require(c.args.empty());
+        const std::string& n = c.callee;
+        if constexpr (std::is_same_v<T, int>) {
+            if (n == "read_int") return std::make_unique<Input<int>>(&builtin_read_int);
+        }
+        if constexpr (std::is_same_v<T, char>) {
+            if (n == "read_char") return std::make_unique<Input<char>>(&builtin_read_char);
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (n == "read_line") return std::make_unique<Input<std::string>>(&builtin_read_line);
+        }
+        if constexpr (std::is_same_v<T, bool>) {
+            if (n == "has_input") return std::make_unique<Input<bool>>(&builtin_has_input);
+            if (n == "has_int") return std::make_unique<Input<bool>>(&builtin_has_int);
+        }
+        throw Unsupported{};
+    }
+
+    // Übersetzt die Argumente und löst das Ziel wie der Interpreter auf
+    // (Werte ohne Referenzparameter; Fehler meldet der Interpreter)
+    const ast::FunctionDef* resolve(const ast::CallExpr& c, std::vector<NodePtr<Value>>& args) {
+        std::vector<ast::Type> types;
+        std::vector<bool> lvalues;
+        for (const auto& arg : c.args) {
+            args.push_back(boxed(*arg));
+            types.push_back(arg->static_type);
+            lvalues.push_back(dynamic_cast<const ast::VarExpr*>(arg.get()) != nullptr);
+        }
+
+        const ast::FunctionDef* callee = nullptr;
+        try {
+            callee = &functions_.resolve(c.callee, types, lvalues);
+        } catch (const std::runtime_error&) {
+            throw Unsupported{};
+        }
+        for (const auto& p : callee->params) require(!p.type.is_ref);
+        return callee;
+    }
+};
+
+// Closure-Engine: übersetzt freie Funktionen beim ersten Aufruf.
+// Nicht übersetzbare Funktionen (Klassen, Referenzen, ...) und mit --memoize gecachte
+// rekursive Funktionen bleiben beim Baum-Interpreter.
+class Engine {
+public:
+    const CompiledFunction* find(const ast::FunctionDef& f, interp::FunctionTable& functions) {
+        auto it = compiled_.find(&f);
+        if (it != compiled_.end()) return it->second.get();
+
+        std::unique_ptr<CompiledFunction> cf;
+        if (interp::memo().recursive(f)) return (compiled_[&f] = nullptr).get(); // Cache im Interpreter
+        try {
+            cf = FunctionCompiler(f, functions).compile();
+            ++interp::stats().closure_functions;
+        } catch (const Unsupported&) {
+        }
+        return (compiled_[&f] = std::move(cf)).get();
+    }
+
+    // Neue Definitionen (REPL) können Overloads und statische Typen ändern: alles verwerfen
+    void reset() { compiled_.clear(); }
+
+private:
+    std::unordered_map<const ast::FunctionDef*, std::unique_ptr<CompiledFunction>> compiled_;
+};
+
+// Prozessweite Closure-Engine
+inline Engine& engine() {
+    static Engine e;
+    return e;
+}
+
+inline const CompiledFunction* find_compiled(const ast::FunctionDef& f, interp::FunctionTable& functions) {
+    return engine().find(f, functions);
+}
+
+} // namespace closure
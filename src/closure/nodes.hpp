@@ -0,0 +1,341 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <memory>      // std::unique_ptr
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+#include "../interp/value.hpp"         // Value
+#include "../interp/env.hpp"           // Env (Umgebung fuer interpretierte Aufrufe)
+#include "../interp/functions.hpp"     // FunctionTable
+#include "../interp/limits.hpp"        // Ausführungslimits (--max-steps, ...)
+#include "../interp/located_error.hpp" // LocatedError
+#include "../ast/location.hpp"         // SourceLoc
+#include "../ast/function.hpp"         // ast::FunctionDef (Tail-Call-Ziel)
+
+namespace closure {
+
+using interp::Value;
+
+struct CompiledFunction; // übersetzte Funktion (compiler.hpp)
+
+// Laufzeit-Frame einer übersetzten Funktion: Parameter und Locals liegen in festen Slots
+struct Frame {
+    Value* slots;                       // Slot i = i-ter Parameter bzw. Local (zur Übersetzungszeit vergeben)
+    interp::Env* env;                   // Umgebung fuer Aufrufe interpretierter Funktionen
+    interp::FunctionTable* functions;
+    Value result;                       // Rückgabewert nach Flow::Return
+
+    // Ziel und Argumente nach Flow::TailCall (tail_fn == nullptr => über den Interpreter)
+    const CompiledFunction* tail_fn = nullptr;
+    const ast::FunctionDef* tail_def = nullptr;
+    std::vector<Value> tail_args;
+
+    Frame(Value* s, interp::Env* e, interp::FunctionTable* fns) : slots(s), env(e), functions(fns) {}
+};
+
+// Ergebnis eines Statements
+enum class Flow : unsigned char {
+    Normal,   // weiter mit dem nächsten Statement
+    Return,   // return ausgeführt (Frame::result gesetzt)
+    TailSelf, // "return f(...);" auf sich selbst: Parameter sind überschrieben, Rumpf neu starten
+    TailCall  // "return g(...);": Frame abbauen und g mit Frame::tail_args fortsetzen
+};
+
+// Closure = Funktionszeiger + vorab aufgelöste Operanden.
+// Ausgewertet wird über den Zeiger (kein dynamic_cast, kein virtueller Aufruf);
+// der virtuelle Destruktor dient nur dem Abbau des Baums.
+template <class T>
+struct Node {
+    using Fn = T (*)(const Node*, Frame&);
+    Fn fn;
+
+    explicit Node(Fn f) : fn(f) {}
+    virtual ~Node() = default;
+
+    T operator()(Frame& f) const { return fn(this, f); }
+};
+
+template <class T>
+using NodePtr = std::unique_ptr<Node<T>>;
+
+// Liest einen Slot, dessen Typ zur Übersetzungszeit feststeht
+template <class T>
+inline T& slot_as(Frame& f, size_t i) {
+    return *std::get_if<T>(&f.slots[i]);
+}
+
+// ---------- Ausdrücke ----------
+
+template <class T>
+struct Const : Node<T> {
+    T value;
+    explicit Const(T v) : Node<T>(&run), value(std::move(v)) {}
+    static T run(const Node<T>* n, Frame&) { return static_cast<const Const*>(n)->value; }
+};
+
+template <class T>
+struct Load : Node<T> {
+    size_t slot;
+    explicit Load(size_t s) : Node<T>(&run), slot(s) {}
+    static T run(const Node<T>* n, Frame& f) { return slot_as<T>(f, static_cast<const Load*>(n)->slot); }
+};
+
+template <class T>
+struct Store : Node<T> {
+    size_t slot;
+    NodePtr<T> value;
+    Store(size_t s, NodePtr<T> v) : Node<T>(&run), slot(s), value(std::move(v)) {}
+    static T run(const Node<T>* n, Frame& f) {
+        auto* self = static_cast<const Store*>(n);
+        T v = (*self->value)(f);
+        slot_as<T>(f, self->slot) = v;
+        return v;
+    }
+};
+
+// Zweistelliger Operator über Operanden vom Typ T mit Ergebnis R (links vor rechts)
+template <class T, class R, class Op>
+struct Binary : Node<R> {
+    NodePtr<T> left, right;
+    Binary(NodePtr<T> l, NodePtr<T> r) : Node<R>(&run), left(std::move(l)), right(std::move(r)) {}
+    static R run(const Node<R>* n, Frame& f) {
+        auto* self = static_cast<const Binary*>(n);
+        T l = (*self->left)(f);
+        T r = (*self->right)(f);
+        return Op::apply(l, r);
+    }
+};
+
+struct OpAdd { static int apply(int l, int r) { return l + r; } };
+struct OpSub { static int apply(int l, int r) { return l - r; } };
+struct OpMul { static int apply(int l, int r) { return l * r; } };
+struct OpDiv {
+    static int apply(int l, int r) {
+        if (r == 0) throw std::runtime_error("runtime error: division by zero");
+        return l / r;
+    }
+};
+struct OpMod {
+    static int apply(int l, int r) {
+        if (r == 0) throw std::runtime_error("runtime error: modulo by zero");
+        return l % r;
+    }
+};
+struct OpLt { template <class T> static bool apply(const T& l, const T& r) { return l < r; } };
+struct OpLe { template <class T> static bool apply(const T& l, const T& r) { return l <= r; } };
+struct OpGt { template <class T> static bool apply(const T& l, const T& r) { return l > r; } };
+struct OpGe { template <class T> static bool apply(const T& l, const T& r) { return l >= r; } };
+struct OpEq { template <class T> static bool apply(const T& l, const T& r) { return l == r; } };
+struct OpNe { template <class T> static bool apply(const T& l, const T& r) { return l != r; } };
+
+struct Negate : Node<int> {
+    NodePtr<int> operand;
+    explicit Negate(NodePtr<int> o) : Node<int>(&run), operand(std::move(o)) {}
+    static int run(const Node<int>* n, Frame& f) { return -(*static_cast<const Negate*>(n)->operand)(f); }
+};
+
+struct Not : Node<bool> {
+    NodePtr<bool> operand;
+    explicit Not(NodePtr<bool> o) : Node<bool>(&run), operand(std::move(o)) {}
+    static bool run(const Node<bool>* n, Frame& f) { return !(*static_cast<const Not*>(n)->operand)(f); }
+};
+
+struct And : Node<bool> {
+    NodePtr<bool> left, right;
+    And(NodePtr<bool> l, NodePtr<bool> r) : Node<bool>(&run), left(std::move(l)), right(std::move(r)) {}
+    static bool run(const Node<bool>* n, Frame& f) {
+        auto* self = static_cast<const And*>(n);
+        return (*self->left)(f) && (*self->right)(f);
+    }
+};
+
+struct Or : Node<bool> {
+    NodePtr<bool> left, right;
+    Or(NodePtr<bool> l, NodePtr<bool> r) : Node<bool>(&run), left(std::move(l)), right(std::move(r)) {}
+    static bool run(const Node<bool>* n, Frame& f) {
+        auto* self = static_cast<const Or*>(n);
+        return (*self->left)(f) || (*self->right)(f);
+    }
+};
+
+// Wahrheitswert wie to_bool_like_cpp (int/char/string als Bedingung)
+template <class T>
+struct Truth : Node<bool> {
+    NodePtr<T> operand;
+    explicit Truth(NodePtr<T> o) : Node<bool>(&run), operand(std::move(o)) {}
+    static bool run(const Node<bool>* n, Frame& f) {
+        T v = (*static_cast<const Truth*>(n)->operand)(f);
+        if constexpr (std::is_same_v<T, std::string>) return !v.empty();
+        else return v != T{};
+    }
+};
+
+// Verpackt einen typisierten Wert als Value (Argumente, Rückgabewerte)
+template <class T>
+struct Box : Node<Value> {
+    NodePtr<T> operand;
+    explicit Box(NodePtr<T> o) : Node<Value>(&run), operand(std::move(o)) {}
+    static Value run(const Node<Value>* n, Frame& f) { return Value{(*static_cast<const Box*>(n)->operand)(f)}; }
+};
+
+// Packt einen Value mit statisch bekanntem Typ aus (Ergebnis eines Aufrufs)
+template <class T>
+struct Unbox : Node<T> {
+    NodePtr<Value> operand;
+    explicit Unbox(NodePtr<Value> o) : Node<T>(&run), operand(std::move(o)) {}
+    static T run(const Node<T>* n, Frame& f) {
+        Value v = (*static_cast<const Unbox*>(n)->operand)(f);
+        return std::move(*std::get_if<T>(&v));
+    }
+};
+
+// Ausdruck als Statement: Ergebnis verwerfen
+template <class T>
+struct Discard : Node<void> {
+    NodePtr<T> operand;
+    explicit Discard(NodePtr<T> o) : Node<void>(&run), operand(std::move(o)) {}
+    static void run(const Node<void>* n, Frame& f) { (*static_cast<const Discard*>(n)->operand)(f); }
+};
+
+// Builtin ohne Argumente (read_*, has_*)
+template <class T>
+struct Input : Node<T> {
+    T (*read)();
+    explicit Input(T (*r)()) : Node<T>(&run), read(r) {}
+    static T run(const Node<T>* n, Frame&) { return static_cast<const Input*>(n)->read(); }
+};
+
+// Builtin mit einem Argument (print_*)
+template <class T>
+struct Output : Node<void> {
+    void (*write)(const T&);
+    NodePtr<T> operand;
+    Output(void (*w)(const T&), NodePtr<T> o) : Node<void>(&run), write(w), operand(std::move(o)) {}
+    static void run(const Node<void>* n, Frame& f) {
+        auto* self = static_cast<const Output*>(n);
+        self->write((*self->operand)(f));
+    }
+};
+
+// ---------- Statements ----------
+
+using StmtPtr = NodePtr<Flow>;
+
+// Statement mit Position: Schrittlimit und Fehlerposition wie exec_stmt
+struct Located {
+    ast::SourceLoc loc;
+    StmtPtr stmt;
+};
+
+inline Flow run_located(const Located& s, Frame& f) {
+    interp::Limits& lim = interp::limits();
+    if (lim.active()) lim.on_step();
+
+    try {
+        return (*s.stmt)(f);
+    } catch (const interp::LocatedError&) {
+        throw;
+    } catch (const interp::LimitExceeded&) {
+        throw;
+    } catch (const std::runtime_error& ex) {
+        if (!s.loc.known()) throw;
+        throw interp::LocatedError(s.loc, ex.what());
+    }
+}
+
+struct Block : Node<Flow> {
+    std::vector<Located> stmts;
+    Block() : Node<Flow>(&run) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        for (const auto& s : static_cast<const Block*>(n)->stmts) {
+            Flow fl = run_located(s, f);
+            if (fl != Flow::Normal) return fl;
+        }
+        return Flow::Normal;
+    }
+};
+
+// Deklaration: Slot mit Initialwert (bzw. Default) belegen
+template <class T>
+struct Declare : Node<Flow> {
+    size_t slot;
+    NodePtr<T> init; // nullptr => T{}
+    Declare(size_t s, NodePtr<T> i) : Node<Flow>(&run), slot(s), init(std::move(i)) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        auto* self = static_cast<const Declare*>(n);
+        f.slots[self->slot] = self->init ? Value{(*self->init)(f)} : Value{T{}};
+        return Flow::Normal;
+    }
+};
+
+struct Effect : Node<Flow> {
+    NodePtr<void> expr;
+    explicit Effect(NodePtr<void> e) : Node<Flow>(&run), expr(std::move(e)) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        (*static_cast<const Effect*>(n)->expr)(f);
+        return Flow::Normal;
+    }
+};
+
+struct If : Node<Flow> {
+    NodePtr<bool> cond;
+    Located then_branch;
+    Located else_branch; // stmt == nullptr => kein else
+    If() : Node<Flow>(&run) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        auto* self = static_cast<const If*>(n);
+        if ((*self->cond)(f)) return run_located(self->then_branch, f);
+        if (self->else_branch.stmt) return run_located(self->else_branch, f);
+        return Flow::Normal;
+    }
+};
+
+struct While : Node<Flow> {
+    NodePtr<bool> cond;
+    Located body;
+    While() : Node<Flow>(&run) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        auto* self = static_cast<const While*>(n);
+        while ((*self->cond)(f)) {
+            Flow fl = run_located(self->body, f);
+            if (fl != Flow::Normal) return fl;
+        }
+        return Flow::Normal;
+    }
+};
+
+struct Return : Node<Flow> {
+    NodePtr<Value> value; // nullptr => "return;"
+    explicit Return(NodePtr<Value> v) : Node<Flow>(&run), value(std::move(v)) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        auto* self = static_cast<const Return*>(n);
+        if (self->value) f.result = (*self->value)(f);
+        return Flow::Return;
+    }
+};
+
+// "return f(...);" in f: Argumente auswerten, dann in die Parameter-Slots schreiben
+struct TailSelf : Node<Flow> {
+    std::vector<NodePtr<Value>> args;
+    TailSelf() : Node<Flow>(&run) {}
+    static Flow run(const Node<Flow>* n, Frame& f) {
+        auto* self = static_cast<const TailSelf*>(n);
+        const size_t count = self->args.size();
+        Value tmp[8];
+        std::vector<Value> many;
+        Value* vals = tmp;
+        if (count > 8) {
+            many.resize(count);
+            vals = many.data();
+        }
+        for (size_t i = 0; i < count; ++i) vals[i] = (*self->args[i])(f);
+        for (size_t i = 0; i < count; ++i) f.slots[i] = std::move(vals[i]);
+        return Flow::TailSelf;
+    }
+};
+
+} // namespace closure
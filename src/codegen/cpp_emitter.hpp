@@ -0,0 +1,612 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <sstream>        // std::ostringstream
+#include <stdexcept>      // std::runtime_error
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <unordered_set>  // std::unordered_set
+#include <vector>         // std::vector
+
+#include "../ast/program.hpp"   // AST: Program, ClassDef, FunctionDef
+#include "../ast/expr.hpp"      // AST: Expression-Knoten
+#include "../ast/stmt.hpp"      // AST: Statement-Knoten
+#include "../ast/type.hpp"      // AST: Type
+#include "../sem/analyzer.hpp"  // sem::Analyzer::builtin_signature
+
+namespace codegen {
+
+// Laufzeitteil jeder erzeugten Übersetzungseinheit: Builtins mit derselben Ausgabe
+// und denselben Fehlermeldungen wie im Interpreter ("FEHLER: zeile:spalte: ...", Exit-Code 1).
+inline const char* cpp_prelude() {
+    return R"(// Erzeugt von mini_cpp --emit-cpp
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+namespace mc {
+
+[[noreturn]] inline void fail(const char* at, const char* msg) {
+    std::fflush(stdout);
+    std::fprintf(stderr, "FEHLER: %s: %s\n", at, msg);
+    std::exit(1);
+}
+
+inline void print_int(int v) { std::printf("%d\n", v); }
+inline void print_bool(bool v) { std::fputs(v ? "1\n" : "0\n", stdout); }
+inline void print_char(char c) { std::putchar(static_cast<unsigned char>(c)); std::putchar('\n'); }
+inline void print_string(const std::string& s) {
+    std::fwrite(s.data(), 1, s.size(), stdout);
+    std::putchar('\n');
+}
+
+inline int peek_byte() {
+    int c = std::getchar();
+    if (c != EOF) std::ungetc(c, stdin);
+    return c;
+}
+inline bool is_space(int c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; }
+inline bool is_digit(int c) { return c >= '0' && c <= '9'; }
+inline void skip_whitespace() {
+    while (is_space(peek_byte())) std::getchar();
+}
+
+inline bool has_input() { return peek_byte() != EOF; }
+inline bool has_int() {
+    skip_whitespace();
+    int c = std::getchar();
+    if (c == EOF) return false;
+    bool ok = is_digit(c);
+    if (!ok && (c == '-' || c == '+')) ok = is_digit(peek_byte());
+    std::ungetc(c, stdin);
+    return ok;
+}
+inline int read_int(const char* at) {
+    skip_whitespace();
+    if (peek_byte() == EOF) fail(at, "runtime error: read_int: end of input");
+    bool neg = false;
+    if (peek_byte() == '-' || peek_byte() == '+') neg = std::getchar() == '-';
+    long long v = 0;
+    bool any = false;
+    while (is_digit(peek_byte())) {
+        v = v * 10 + (std::getchar() - '0');
+        if (v > 2147483648LL) fail(at, "runtime error: read_int: integer out of range");
+        any = true;
+    }
+    if (!any) fail(at, "runtime error: read_int: expected integer");
+    if (neg) v = -v;
+    if (v > 2147483647LL) fail(at, "runtime error: read_int: integer out of range");
+    return static_cast<int>(v);
+}
+inline char read_char() {
+    int c = std::getchar();
+    return c == EOF ? '\0' : static_cast<char>(c);
+}
+inline std::string read_line() {
+    std::string line;
+    int c;
+    while ((c = std::getchar()) != EOF && c != '\n') line.push_back(static_cast<char>(c));
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    return line;
+}
+
+inline int div(int l, int r, const char* at) {
+    if (r == 0) fail(at, "runtime error: division by zero");
+    return l / r;
+}
+inline int mod(int l, int r, const char* at) {
+    if (r == 0) fail(at, "runtime error: modulo by zero");
+    return l % r;
+}
+
+// Wahrheitswerte wie im Interpreter (to_bool_like_cpp)
+inline bool truth(bool v) { return v; }
+inline bool truth(int v) { return v != 0; }
+inline bool truth(char v) { return v != '\0'; }
+inline bool truth(const std::string& v) { return !v.empty(); }
+
+} // namespace mc
+)";
+}
+
+// Übersetzt ein (semantisch geprüftes) ast::Program in eine eigenständige C++17-Datei.
+// Klassen werden zu C++-Klassen mit denselben Feldern, Konstruktoren und virtual-Markierungen,
+// Slicing und virtueller Dispatch ergeben sich damit direkt aus der C++-Semantik.
+// Skriptnamen liegen im Namensraum "script"; main() wird zu script::main_ und von einem
+// erzeugten ::main aufgerufen. Abweichend von C++ wird wie im Interpreter strikt von links
+// nach rechts ausgewertet (mehrere Argumente mit Seiteneffekten laufen über ein Lambda).
+// Der Interpreter wählt Overloads nach dem dynamischen Typ der Objektargumente, C++ nach dem
+// statischen: Aufrufe, bei denen beide abweichen können, werden abgelehnt (exact_class_arg).
+class CppEmitter {
+public:
+    explicit CppEmitter(const ast::Program& p) : prog_(p) {
+        for (const auto& c : prog_.classes)
+            if (!c.base_name.empty()) has_derived_.insert(c.base_name);
+    }
+
+    std::string emit() {
+        out_.str("");
+        out_ << cpp_prelude() << "\nnamespace script {\n\n";
+
+        for (const auto& c : prog_.classes) out_ << "class " << ident(c.name) << ";\n";
+        if (!prog_.classes.empty()) out_ << "\n";
+
+        for (const auto& f : prog_.functions) out_ << function_head(f, false) << ";\n";
+        if (!prog_.functions.empty()) out_ << "\n";
+
+        for (const ast::ClassDef* c : class_order()) emit_class(*c);
+
+        for (const auto& c : prog_.classes) {
+            for (const auto& ctor : c.ctors) emit_ctor(c, ctor);
+            for (const auto& m : c.methods) emit_method(c, m);
+        }
+        for (const auto& f : prog_.functions) emit_function(f);
+
+        out_ << "} // namespace script\n\n";
+        emit_entry();
+        return out_.str();
+    }
+
+private:
+    const ast::Program& prog_;
+    std::ostringstream out_;
+    int indent_ = 0;
+    bool in_member_ = false;       // true => Rumpf einer Methode/eines Konstruktors
+    std::string at_ = "0:0";       // Position des aktuellen Statements (Fehlermeldungen)
+    std::unordered_set<std::string> has_derived_; // Klassen mit abgeleiteten Klassen
+
+    // Sichtbare Namen des Rumpfs: true => Objekt hat genau seinen statischen Typ
+    // (Klassen-Local ohne & oder Wertparameter: Kopien werden auf den Typ zugeschnitten,
+    // Wertparameter passen exakt); Referenzen können auf abgeleitete Objekte zeigen
+    std::vector<std::unordered_map<std::string, bool>> scopes_;
+
+    // ---------- Namen und Typen ----------
+
+    // C++-Schlüsselwörter (und reservierte Namen), die als Skriptnamen erlaubt sind
+    static bool is_reserved(const std::string& n) {
+        static const std::unordered_set<std::string> kw = {
+            "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "break",
+            "case", "catch", "char16_t", "char32_t", "compl", "const", "constexpr",
+            "const_cast", "continue", "decltype", "default", "delete", "do", "double",
+            "dynamic_cast", "enum", "explicit", "export", "extern", "float", "for", "friend",
+            "goto", "inline", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+            "nullptr", "operator", "or", "or_eq", "private", "protected", "register",
+            "reinterpret_cast", "short", "signed", "sizeof", "static", "static_assert",
+            "static_cast", "struct", "switch", "template", "this", "thread_local", "throw",
+            "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "volatile",
+            "wchar_t", "xor", "xor_eq", "override", "final", "main", "mc", "script", "std"};
+        return kw.count(n) > 0;
+    }
+
+    // Reservierte Namen und das Präfix "mc_" (Hilfsvariablen des Emitters) bekommen ein "_"
+    static std::string ident(const std::string& n) {
+        return (is_reserved(n) || n.rfind("mc_", 0) == 0) ? n + "_" : n;
+    }
+
+    std::string type_name(const ast::Type& t) const {
+        std::string s;
+        switch (t.base) {
+            case ast::Type::Base::Bool:   s = "bool"; break;
+            case ast::Type::Base::Int:    s = "int"; break;
+            case ast::Type::Base::Char:   s = "char"; break;
+            case ast::Type::Base::String: s = "std::string"; break;
+            case ast::Type::Base::Void:   s = "void"; break;
+            case ast::Type::Base::Class:  s = ident(t.class_name); break;
+        }
+        if (t.is_ref) s += "&";
+        return s;
+    }
+
+    // Initialisierer fuer Felder/Variablen ohne Initialisierung (Default-Werte des Interpreters)
+    static const char* default_init(const ast::Type& t) {
+        switch (t.base) {
+            case ast::Type::Base::Bool: return " = false";
+            case ast::Type::Base::Int:  return " = 0";
+            case ast::Type::Base::Char: return " = '\\0'";
+            default:                    return "";
+        }
+    }
+
+    std::string params(const std::vector<ast::Param>& ps) const {
+        std::string s = "(";
+        for (size_t i = 0; i < ps.size(); ++i) {
+            if (i) s += ", ";
+            s += type_name(ps[i].type) + " " + ident(ps[i].name);
+        }
+        return s + ")";
+    }
+
+    std::string function_head(const ast::FunctionDef& f, bool qualified) const {
+        return type_name(f.return_type) + " " + (qualified ? "script::" : "") + ident(f.name) + params(f.params);
+    }
+
+    // ---------- Klassen ----------
+
+    // Klassen in Definitionsreihenfolge: Basisklassen und Felder mit Klassentyp zuerst
+    std::vector<const ast::ClassDef*> class_order() const {
+        std::unordered_map<std::string, const ast::ClassDef*> by_name;
+        for (const auto& c : prog_.classes) by_name.emplace(c.name, &c);
+
+        std::vector<const ast::ClassDef*> order;
+        std::unordered_set<std::string> done;
+        std::unordered_set<std::string> active;
+
+        auto visit = [&](auto&& self, const ast::ClassDef& c) -> void {
+            if (done.count(c.name) || active.count(c.name)) return;
+            active.insert(c.name);
+
+            auto dep = [&](const std::string& name) {
+                auto it = by_name.find(name);
+                if (it != by_name.end()) self(self, *it->second);
+            };
+            if (!c.base_name.empty()) dep(c.base_name);
+            for (const auto& f : c.fields)
+                if (f.type.base == ast::Type::Base::Class && !f.type.is_ref) dep(f.type.class_name);
+
+            active.erase(c.name);
+            done.insert(c.name);
+            order.push_back(&c);
+        };
+        for (const auto& c : prog_.classes) visit(visit, c);
+        return order;
+    }
+
+    void emit_class(const ast::ClassDef& c) {
+        out_ << "class " << ident(c.name);
+        if (!c.base_name.empty()) out_ << " : public " << ident(c.base_name);
+        out_ << " {\npublic:\n";
+
+        for (const auto& f : c.fields)
+            out_ << "    " << type_name(f.type) << " " << ident(f.name) << default_init(f.type) << ";\n";
+
+        for (const auto& ctor : c.ctors)
+            out_ << "    " << ident(c.name) << params(ctor.params) << ";\n";
+
+        for (const auto& m : c.methods) {
+            out_ << "    " << (m.is_virtual ? "virtual " : "") << type_name(m.return_type) << " "
+                 << ident(m.name) << params(m.params) << ";\n";
+        }
+
+        out_ << "};\n\n";
+    }
+
+    void emit_ctor(const ast::ClassDef& c, const ast::ConstructorDef& ctor) {
+        out_ << ident(c.name) << "::" << ident(c.name) << params(ctor.params) << " ";
+        emit_body(ctor.body.get(), ctor.params, ast::Type::Void(), true);
+    }
+
+    void emit_method(const ast::ClassDef& c, const ast::MethodDef& m) {
+        out_ << type_name(m.return_type) << " " << ident(c.name) << "::" << ident(m.name)
+             << params(m.params) << " ";
+        emit_body(m.body.get(), m.params, m.return_type, true);
+    }
+
+    void emit_function(const ast::FunctionDef& f) {
+        out_ << function_head(f, false) << " ";
+        emit_body(f.body.get(), f.params, f.return_type, false);
+    }
+
+    // Rumpf; nicht-void Funktionen ohne return liefern wie im Interpreter den Default-Wert
+    void emit_body(const ast::Stmt* body, const std::vector<ast::Param>& ps, const ast::Type& ret,
+                   bool member) {
+        in_member_ = member;
+        indent_ = 0;
+        out_ << "{\n";
+        indent_ = 1;
+        scopes_.assign(1, {});
+        for (const auto& p : ps) scopes_.back()[p.name] = !p.type.is_ref;
+        if (body) {
+            if (auto* b = dynamic_cast<const ast::BlockStmt*>(body)) {
+                for (const auto& st : b->statements) emit_stmt(*st);
+            } else {
+                emit_stmt(*body);
+            }
+        }
+        scopes_.clear();
+        if (ret.base != ast::Type::Base::Void && !ends_with_return(body))
+            line() << "return " << type_name(ast::strip_ref(ret)) << "();\n";
+        indent_ = 0;
+        out_ << "}\n\n";
+    }
+
+    static bool ends_with_return(const ast::Stmt* s) {
+        if (!s) return false;
+        if (dynamic_cast<const ast::ReturnStmt*>(s)) return true;
+        if (auto* b = dynamic_cast<const ast::BlockStmt*>(s))
+            return !b->statements.empty() && ends_with_return(b->statements.back().get());
+        return false;
+    }
+
+    // Einstiegspunkt: ruft script::main_ auf und liefert dessen Exit-Code
+    void emit_entry() {
+        const ast::FunctionDef* script_main = nullptr;
+        for (const auto& f : prog_.functions)
+            if (f.name == "main" && f.params.empty()) script_main = &f;
+
+        out_ << "int main() {\n";
+        out_ << "    static char buffer[1 << 16];\n";
+        out_ << "    std::setvbuf(stdout, buffer, _IOFBF, sizeof buffer);\n";
+        if (script_main && script_main->return_type.base == ast::Type::Base::Int) {
+            out_ << "    int rc = script::main_();\n";
+            out_ << "    std::fflush(stdout);\n";
+            out_ << "    return rc;\n";
+        } else {
+            if (script_main) out_ << "    script::main_();\n";
+            out_ << "    std::fflush(stdout);\n";
+            out_ << "    return 0;\n";
+        }
+        out_ << "}\n";
+    }
+
+    // ---------- Statements ----------
+
+    std::ostream& line() {
+        for (int i = 0; i < indent_; ++i) out_ << "    ";
+        return out_;
+    }
+
+    static std::string loc_text(const ast::SourceLoc& loc) {
+        return std::to_string(loc.line) + ":" + std::to_string(loc.col);
+    }
+
+    void emit_block_or_stmt(const ast::Stmt& s) {
+        if (dynamic_cast<const ast::BlockStmt*>(&s)) {
+            emit_stmt(s);
+            return;
+        }
+        line() << "{\n";
+        ++indent_;
+        emit_stmt(s);
+        --indent_;
+        line() << "}\n";
+    }
+
+    void emit_stmt(const ast::Stmt& s) {
+        using namespace ast;
+        if (s.loc.known()) at_ = loc_text(s.loc);
+
+        if (auto* b = dynamic_cast<const BlockStmt*>(&s)) {
+            line() << "{\n";
+            ++indent_;
+            scopes_.emplace_back();
+            for (const auto& st : b->statements) emit_stmt(*st);
+            scopes_.pop_back();
+            --indent_;
+            line() << "}\n";
+            return;
+        }
+
+        if (auto* v = dynamic_cast<const VarDeclStmt*>(&s)) {
+            line() << type_name(v->decl_type) << " " << ident(v->name);
+            if (v->init) out_ << " = " << expr(*v->init);
+            else out_ << default_init(v->decl_type);
+            out_ << ";\n";
+            scopes_.back()[v->name] = !v->decl_type.is_ref;
+            return;
+        }
+
+        if (auto* e = dynamic_cast<const ExprStmt*>(&s)) {
+            line() << expr(*e->expr) << ";\n";
+            return;
+        }
+
+        if (auto* i = dynamic_cast<const IfStmt*>(&s)) {
+            line() << "if (" << condition(*i->cond) << ")\n";
+            emit_block_or_stmt(*i->then_branch);
+            if (i->else_branch) {
+                line() << "else\n";
+                emit_block_or_stmt(*i->else_branch);
+            }
+            return;
+        }
+
+        if (auto* w = dynamic_cast<const WhileStmt*>(&s)) {
+            line() << "while (" << condition(*w->cond) << ")\n";
+            emit_block_or_stmt(*w->body);
+            return;
+        }
+
+        if (auto* r = dynamic_cast<const ReturnStmt*>(&s)) {
+            if (r->value) line() << "return " << expr(*r->value) << ";\n";
+            else line() << "return;\n";
+            return;
+        }
+
+        throw std::runtime_error("emit-cpp: unknown statement");
+    }
+
+    // ---------- Ausdrücke ----------
+
+    // Hat die Auswertung (möglicherweise) Seiteneffekte?
+    static bool impure(const ast::Expr& e) {
+        using namespace ast;
+        if (dynamic_cast<const CallExpr*>(&e) || dynamic_cast<const MethodCallExpr*>(&e) ||
+            dynamic_cast<const ConstructExpr*>(&e) || dynamic_cast<const AssignExpr*>(&e) ||
+            dynamic_cast<const FieldAssignExpr*>(&e))
+            return true;
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) return impure(*u->expr);
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) return impure(*b->left) || impure(*b->right);
+        if (auto* m = dynamic_cast<const MemberAccessExpr*>(&e)) return impure(*m->object);
+        return false;
+    }
+
+    static std::string string_literal(const std::string& s) {
+        std::string r = "std::string(\"";
+        for (unsigned char c : s) {
+            if (c == '"' || c == '\\') {
+                r += '\\';
+                r += static_cast<char>(c);
+            } else if (c >= 0x20 && c < 0x7f) {
+                r += static_cast<char>(c);
+            } else {
+                const char oct[] = {'\\', char('0' + (c >> 6)), char('0' + ((c >> 3) & 7)), char('0' + (c & 7)), 0};
+                r += oct;
+            }
+        }
+        return r + "\", " + std::to_string(s.size()) + ")";
+    }
+
+    std::string condition(const ast::Expr& e) {
+        return "mc::truth(" + expr(e) + ")";
+    }
+
+    // Aufruf callee(args...) mit Auswertung von links nach rechts.
+    // Mehrere Argumente mit Seiteneffekten werden in einem Lambda vorab ausgewertet;
+    // std::forward erhält die Wertkategorie (Overloads mit T& vs. T).
+    std::string call(const std::string& callee, const std::vector<const ast::Expr*>& args,
+                     const std::string& extra = "") {
+        int impure_args = 0;
+        for (const auto* a : args) impure_args += impure(*a) ? 1 : 0;
+
+        std::string list;
+        if (impure_args < 2) {
+            for (size_t i = 0; i < args.size(); ++i) {
+                if (i) list += ", ";
+                list += expr(*args[i]);
+            }
+            if (!extra.empty()) list += (args.empty() ? "" : ", ") + extra;
+            return callee + "(" + list + ")";
+        }
+
+        std::string s = "[&]() -> decltype(auto) { ";
+        for (size_t i = 0; i < args.size(); ++i) {
+            std::string n = "mc_a" + std::to_string(i);
+            s += "auto&& " + n + " = " + expr(*args[i]) + "; ";
+            if (i) list += ", ";
+            list += "std::forward<decltype(" + n + ")>(" + n + ")";
+        }
+        if (!extra.empty()) list += ", " + extra;
+        return s + "return " + callee + "(" + list + "); }()";
+    }
+
+    static std::vector<const ast::Expr*> arg_list(const std::vector<ast::ExprPtr>& args) {
+        std::vector<const ast::Expr*> v;
+        v.reserve(args.size());
+        for (const auto& a : args) v.push_back(a.get());
+        return v;
+    }
+
+    std::string quoted_at() const { return "\"" + at_ + "\""; }
+
+    // true, wenn der dynamische Typ des Arguments sicher seinem statischen entspricht
+    bool exact_class_arg(const ast::Expr& a) const {
+        if (a.static_type.base != ast::Type::Base::Class || !has_derived_.count(a.static_type.class_name))
+            return true;
+        if (dynamic_cast<const ast::ConstructExpr*>(&a)) return true;
+        if (auto* v = dynamic_cast<const ast::VarExpr*>(&a)) {
+            for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it) {
+                auto d = it->find(v->name);
+                if (d != it->end()) return d->second;
+            }
+        }
+        return false; // Referenzen, Felder, Rückgabewerte
+    }
+
+    // Overloads wählt der Interpreter nach dem dynamischen Typ: nur übersetzen, wenn er
+    // für jedes Objektargument feststeht
+    void check_overload_args(const std::string& callee, const std::vector<ast::ExprPtr>& args) const {
+        for (const auto& a : args) {
+            if (exact_class_arg(*a)) continue;
+            throw std::runtime_error("emit-cpp: " + at_ + ": Aufruf von " + callee +
+                                     " mit Argument vom Typ " + a->static_type.class_name +
+                                     ", das zur Laufzeit eine abgeleitete Klasse sein kann "
+                                     "(der Interpreter wählt Overloads nach dem dynamischen Typ)");
+        }
+    }
+
+    std::string expr(const ast::Expr& e) {
+        using namespace ast;
+
+        if (auto* i = dynamic_cast<const IntLiteral*>(&e)) return std::to_string(i->value);
+        if (auto* b = dynamic_cast<const BoolLiteral*>(&e)) return b->value ? "true" : "false";
+        if (auto* c = dynamic_cast<const CharLiteral*>(&e))
+            return "char(" + std::to_string(static_cast<int>(c->value)) + ")";
+        if (auto* s = dynamic_cast<const StringLiteral*>(&e)) return string_literal(s->value);
+
+        if (auto* v = dynamic_cast<const VarExpr*>(&e)) return ident(v->name);
+
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) {
+            if (u->op == UnaryExpr::Op::Neg) return "(-" + expr(*u->expr) + ")";
+            return "(!" + expr(*u->expr) + ")";
+        }
+
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
+            if (b->op == BinaryExpr::Op::AndAnd)
+                return "(" + condition(*b->left) + " && " + condition(*b->right) + ")";
+            if (b->op == BinaryExpr::Op::OrOr)
+                return "(" + condition(*b->left) + " || " + condition(*b->right) + ")";
+            if (b->op == BinaryExpr::Op::Div) return call("mc::div", {b->left.get(), b->right.get()}, quoted_at());
+            if (b->op == BinaryExpr::Op::Mod) return call("mc::mod", {b->left.get(), b->right.get()}, quoted_at());
+
+            const char* op = "";
+            switch (b->op) {
+                case BinaryExpr::Op::Add: op = " + "; break;
+                case BinaryExpr::Op::Sub: op = " - "; break;
+                case BinaryExpr::Op::Mul: op = " * "; break;
+                case BinaryExpr::Op::Lt:  op = " < "; break;
+                case BinaryExpr::Op::Le:  op = " <= "; break;
+                case BinaryExpr::Op::Gt:  op = " > "; break;
+                case BinaryExpr::Op::Ge:  op = " >= "; break;
+                case BinaryExpr::Op::Eq:  op = " == "; break;
+                case BinaryExpr::Op::Ne:  op = " != "; break;
+                default: break;
+            }
+            // Beide Seiten mit Seiteneffekten: linke Seite zuerst auswerten
+            if (impure(*b->left) && impure(*b->right))
+                return "[&]() { auto mc_l = " + expr(*b->left) + "; return mc_l" + op + expr(*b->right) + "; }()";
+            return "(" + expr(*b->left) + op + expr(*b->right) + ")";
+        }
+
+        if (auto* a = dynamic_cast<const AssignExpr*>(&e))
+            return "(" + ident(a->name) + " = " + expr(*a->value) + ")";
+
+        if (auto* fa = dynamic_cast<const FieldAssignExpr*>(&e)) {
+            // Interpreter: erst das Objekt, dann der Wert
+            if (impure(*fa->object) && impure(*fa->value)) {
+                return "[&]() -> decltype(auto) { auto&& mc_o = " + expr(*fa->object) + "; return (mc_o." +
+                       ident(fa->field) + " = " + expr(*fa->value) + "); }()";
+            }
+            return "(" + expr(*fa->object) + "." + ident(fa->field) + " = " + expr(*fa->value) + ")";
+        }
+
+        if (auto* m = dynamic_cast<const MemberAccessExpr*>(&e))
+            return expr(*m->object) + "." + ident(m->field);
+
+        if (auto* c = dynamic_cast<const CallExpr*>(&e)) {
+            const std::string& n = c->callee;
+            sem::FuncSymbol builtin;
+            if (sem::Analyzer::builtin_signature(n, builtin)) {
+                // read_int meldet Fehler mit Position wie der Interpreter
+                if (n == "read_int") return call("mc::read_int", arg_list(c->args), quoted_at());
+                return call("mc::" + n, arg_list(c->args));
+            }
+
+            check_overload_args(n, c->args);
+
+            // In Methoden würden gleichnamige Member die freie Funktion verdecken
+            std::string callee = (n == "main") ? "main_" : ident(n);
+            if (in_member_) callee = "script::" + callee;
+            return call(callee, arg_list(c->args));
+        }
+
+        if (auto* ce = dynamic_cast<const ConstructExpr*>(&e)) {
+            check_overload_args(ce->class_name, ce->args);
+            return call(ident(ce->class_name), arg_list(ce->args));
+        }
+
+        if (auto* mc = dynamic_cast<const MethodCallExpr*>(&e)) {
+            check_overload_args(mc->method, mc->args);
+            return call(expr(*mc->object) + "." + ident(mc->method), arg_list(mc->args));
+        }
+
+        throw std::runtime_error("emit-cpp: unknown expression");
+    }
+};
+
+// Übersetzt ein Programm in eine eigenständige C++17-Übersetzungseinheit
+inline std::string emit_cpp(const ast::Program& p) {
+    return CppEmitter(p).emit();
+}
+
+} // namespace codegen
@@ -0,0 +1,170 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cerrno>     // errno, EEXIST, EINTR
+#include <cstdint>    // std::uint64_t
+#include <cstdio>     // std::snprintf
+#include <cstdlib>    // std::getenv
+#include <cstring>    // std::strerror
+#include <fstream>    // std::ofstream
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include <fcntl.h>    // open
+#include <sys/resource.h> // setrlimit(RLIMIT_STACK)
+#include <sys/stat.h> // mkdir, stat
+#include <sys/wait.h> // waitpid, WIFEXITED, ...
+#include <unistd.h>   // fork, execvp, dup2, getpid
+
+namespace codegen {
+
+// FNV-1a (64 Bit) als Cache-Schlüssel für erzeugte Binaries
+inline std::uint64_t fnv1a64(const std::string& data, std::uint64_t h = 1469598103934665603ULL) {
+    for (unsigned char c : data) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Cache-Verzeichnis: $XDG_CACHE_HOME/mini_cpp bzw. ~/.cache/mini_cpp (Fallback: /tmp)
+inline std::string native_cache_dir() {
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg) return std::string(xdg) + "/mini_cpp";
+    if (const char* home = std::getenv("HOME"); home && *home) return std::string(home) + "/.cache/mini_cpp";
+    return "/tmp/mini_cpp-cache";
+}
+
+// Legt ein Verzeichnis samt fehlender Elternverzeichnisse an (mkdir -p)
+inline void make_dirs(const std::string& path) {
+    for (size_t pos = 1; pos <= path.size(); ++pos) {
+        if (pos != path.size() && path[pos] != '/') continue;
+        std::string part = path.substr(0, pos);
+        if (::mkdir(part.c_str(), 0755) != 0 && errno != EEXIST)
+            throw std::runtime_error("native: konnte Verzeichnis nicht anlegen: " + part +
+                                     " (" + std::strerror(errno) + ")");
+    }
+}
+
+inline bool file_exists(const std::string& path) {
+    struct stat st;
+    return ::stat(path.c_str(), &st) == 0;
+}
+
+// Wartet auf einen Kindprozess; Exit-Code wie in der Shell (Signal => 128 + Nummer)
+inline int wait_child(pid_t pid) {
+    int status = 0;
+    while (::waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) throw std::runtime_error(std::string("native: waitpid: ") + std::strerror(errno));
+    }
+    if (WIFEXITED(status)) return WEXITSTATUS(status);
+    if (WIFSIGNALED(status)) return 128 + WTERMSIG(status);
+    return 1;
+}
+
+// Startet argv[0] (per PATH-Suche) und liefert den Exit-Code.
+// stdin/stdout des Kindes können auf Dateien umgelenkt werden (leer => erben).
+// stack_bytes > 0 hebt das Stack-Limit des Kindes (höchstens bis zum Hard-Limit) an:
+// der Haupt-Thread des erzeugten Programms wächst dann bis dorthin (tiefe Rekursion).
+inline int run_process(const std::vector<std::string>& args,
+                       const std::string& stdin_path = "",
+                       const std::string& stdout_path = "",
+                       std::uint64_t stack_bytes = 0) {
+    std::vector<char*> argv;
+    for (const auto& a : args) argv.push_back(const_cast<char*>(a.c_str()));
+    argv.push_back(nullptr);
+
+    // Dateien vor fork öffnen: Fehler landen so im Elternprozess
+    int in_fd = -1;
+    int out_fd = -1;
+    if (!stdin_path.empty()) {
+        in_fd = ::open(stdin_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (in_fd < 0)
+            throw std::runtime_error("konnte Eingabedatei nicht oeffnen: " + stdin_path +
+                                     " (" + std::strerror(errno) + ")");
+    }
+    if (!stdout_path.empty()) {
+        out_fd = ::open(stdout_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (out_fd < 0) {
+            if (in_fd >= 0) ::close(in_fd);
+            throw std::runtime_error("konnte Ausgabedatei nicht oeffnen: " + stdout_path +
+                                     " (" + std::strerror(errno) + ")");
+        }
+    }
+
+    pid_t pid = ::fork();
+    if (pid < 0) throw std::runtime_error(std::string("native: fork: ") + std::strerror(errno));
+    if (pid == 0) {
+        if (in_fd >= 0) ::dup2(in_fd, 0);
+        if (out_fd >= 0) ::dup2(out_fd, 1);
+        if (stack_bytes) {
+            rlimit rl;
+            if (::getrlimit(RLIMIT_STACK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY &&
+                rl.rlim_cur < stack_bytes) {
+                rl.rlim_cur = (rl.rlim_max == RLIM_INFINITY || rl.rlim_max > stack_bytes)
+                                  ? static_cast<rlim_t>(stack_bytes) : rl.rlim_max;
+                ::setrlimit(RLIMIT_STACK, &rl);
+            }
+        }
+        ::execvp(argv[0], argv.data());
+        ::_exit(127);
+    }
+
+    if (in_fd >= 0) ::close(in_fd);
+    if (out_fd >= 0) ::close(out_fd);
+    return wait_child(pid);
+}
+
+// Compiler-Aufruf fuer --native: $CXX (Default c++) mit festen Optimierungsflags.
+// -fwrapv: int-Überlauf ist im erzeugten Code definiert (modulo 2^32), damit der Optimierer
+// keine Schleifen auf Annahmen über Überläufe baut. Im Interpreter bleibt er wie in C++
+// undefiniert; Skripte mit Überlauf können sich daher unterschiedlich verhalten.
+inline std::vector<std::string> native_compiler_command() {
+    const char* cxx = std::getenv("CXX");
+    return {cxx && *cxx ? cxx : "c++", "-std=c++17", "-O2", "-fwrapv", "-w"};
+}
+
+// Liefert den Pfad eines Binaries für die erzeugte C++-Quelle.
+// Schlüssel ist der Hash über Quelle und Compiler-Aufruf; vorhandene Binaries werden
+// wiederverwendet, neue über temporäre Dateien + rename atomar in den Cache gelegt.
+inline std::string build_native(const std::string& cpp_source) {
+    const std::vector<std::string> cmd = native_compiler_command();
+
+    std::uint64_t h = fnv1a64(cpp_source);
+    for (const auto& part : cmd) h = fnv1a64(part + '\0', h);
+
+    char name[32];
+    std::snprintf(name, sizeof name, "%016llx", static_cast<unsigned long long>(h));
+
+    const std::string dir = native_cache_dir();
+    const std::string binary = dir + "/" + name;
+    if (file_exists(binary)) return binary;
+
+    make_dirs(dir);
+    const std::string tmp = binary + ".tmp" + std::to_string(::getpid());
+    const std::string src = tmp + ".cpp";
+    {
+        std::ofstream out(src, std::ios::binary);
+        if (!out) throw std::runtime_error("native: konnte Quelle nicht schreiben: " + src);
+        out << cpp_source;
+        if (!out) throw std::runtime_error("native: konnte Quelle nicht schreiben: " + src);
+    }
+
+    std::vector<std::string> args = cmd;
+    args.insert(args.end(), {"-o", tmp, src});
+    int rc = run_process(args);
+    ::unlink(src.c_str());
+
+    if (rc != 0) {
+        ::unlink(tmp.c_str());
+        throw std::runtime_error("native: Compiler fehlgeschlagen (" + cmd[0] + ", Exit-Code " +
+                                 std::to_string(rc) + ")");
+    }
+    if (std::rename(tmp.c_str(), binary.c_str()) != 0) {
+        ::unlink(tmp.c_str());
+        throw std::runtime_error("native: konnte Binary nicht ablegen: " + binary);
+    }
+    return binary;
+}
+
+} // namespace codegen
@@ -17,8 +17,8 @@ inline Value deep_copy_value(const Value& v) {
     if (auto* o = std::get_if<ObjectPtr>(&v)) {
         if (!*o) throw std::runtime_error("null object value");
 
-        ObjectPtr dst = std::make_shared<Object>();
-        dst->dynamic_class = (*o)->dynamic_class;
+        ++stats().object_deep_copies;
+        ObjectPtr dst = make_object((*o)->dynamic_class, (*o)->fields.size());
         for (const auto& [k, vv] : (*o)->fields) {
             dst->fields[k] = deep_copy_value(vv);
         }
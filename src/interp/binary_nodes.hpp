@@ -0,0 +1,73 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+
+#include "value.hpp"          // Laufzeitwerte
+#include "env.hpp"            // Env
+#include "../ast/expr.hpp"    // ast::BinaryExpr
+
+namespace interp {
+
+struct FunctionTable;
+
+// Vorwärtsdeklaration: Ausdrucksauswertung (exec.hpp)
+inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions);
+
+// BinaryExpr, dessen Operator und Operandentyp nach der Typprüfung feststehen
+// (opt::specialise_binaries). Bleibt ein BinaryExpr, damit alle übrigen Durchläufe
+// (sem, JIT, Closure-Engine, C++-Emitter) unverändert funktionieren.
+struct SpecialisedBinary : ast::BinaryExpr {
+    virtual Value eval(Env& env, FunctionTable& functions) const = 0;
+};
+
+// Operatoren als Typen (Template-Parameter der Knoten)
+struct AddOp { static int apply(int l, int r) { return l + r; } };
+struct SubOp { static int apply(int l, int r) { return l - r; } };
+struct MulOp { static int apply(int l, int r) { return l * r; } };
+struct DivOp {
+    static int apply(int l, int r) {
+        if (r == 0) throw std::runtime_error("runtime error: division by zero");
+        return l / r;
+    }
+};
+struct ModOp {
+    static int apply(int l, int r) {
+        if (r == 0) throw std::runtime_error("runtime error: modulo by zero");
+        return l % r;
+    }
+};
+struct Lt { template <class T> static bool apply(const T& l, const T& r) { return l < r; } };
+struct Le { template <class T> static bool apply(const T& l, const T& r) { return l <= r; } };
+struct Gt { template <class T> static bool apply(const T& l, const T& r) { return l > r; } };
+struct Ge { template <class T> static bool apply(const T& l, const T& r) { return l >= r; } };
+struct Eq { template <class T> static bool apply(const T& l, const T& r) { return l == r; } };
+struct Ne { template <class T> static bool apply(const T& l, const T& r) { return l != r; } };
+
+// int-Arithmetik: ArithNode<AddOp>, ...
+// (Template-Parameter nicht "Op": das würde BinaryExpr::Op verdecken)
+template <class Operation>
+struct ArithNode : SpecialisedBinary {
+    Value eval(Env& env, FunctionTable& functions) const override {
+        Value l = eval_expr(env, *left, functions);
+        Value r = eval_expr(env, *right, functions);
+        return Value{Operation::apply(*std::get_if<int>(&l), *std::get_if<int>(&r))};
+    }
+};
+
+// Vergleich zweier Operanden vom Typ T: CmpNode<Lt, int>, CmpNode<Eq, std::string>, ...
+template <class Operation, class T>
+struct CmpNode : SpecialisedBinary {
+    Value eval(Env& env, FunctionTable& functions) const override {
+        Value l = eval_expr(env, *left, functions);
+        Value r = eval_expr(env, *right, functions);
+        return Value{Operation::apply(*std::get_if<T>(&l), *std::get_if<T>(&r))};
+    }
+};
+
+// Gleichheit: EqNode<std::string> = CmpNode<Eq, std::string>
+template <class T>
+using EqNode = CmpNode<Eq, T>;
+
+} // namespace interp
@@ -0,0 +1,50 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+#include "functions.hpp"  // FunctionTable (Funktionen + Klassen-Runtime)
+#include "../ast/type.hpp"
+
+namespace interp {
+
+// Aufrufbare Einheit (FunctionDef*, MethodDef*, CtorPlan*) -> lesbarer Name
+// Profiling-Werkzeuge speichern nur die Pointer und benennen sie erst beim Bericht.
+using CallLabels = std::unordered_map<const void*, std::string>;
+
+// Formatiert eine Parameterliste: "(int,bool&)"
+inline std::string param_list_label(const std::vector<ast::Param>& params) {
+    std::string s = "(";
+    for (size_t i = 0; i < params.size(); ++i) {
+        if (i) s += ",";
+        s += ast::to_string(params[i].type);
+    }
+    s += ")";
+    return s;
+}
+
+// Baut die Namen aller registrierten Funktionen, Methoden und Konstruktoren auf
+inline CallLabels build_call_labels(const FunctionTable& functions) {
+    CallLabels labels;
+
+    for (const auto& kv : functions.functions)
+        for (const ast::FunctionDef* f : kv.second)
+            labels[f] = f->name + param_list_label(f->params);
+
+    for (const auto& kv : functions.class_rt.classes) {
+        const ClassInfo& ci = kv.second;
+
+        for (const auto& mv : ci.methods)
+            for (const auto& mi : mv.second)
+                labels[mi.def] = mi.owner_class + "::" + mi.def->name + param_list_label(mi.def->params);
+
+        for (const auto& cti : ci.ctors)
+            labels[&cti.plan] = ci.name + "::" + ci.name + param_list_label(cti.def->params);
+        labels[&ci.default_plan] = ci.name + "::" + ci.name + "()";
+    }
+    return labels;
+}
+
+} // namespace interp
@@ -0,0 +1,78 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <atomic>     // std::atomic (Zugriff aus dem Signal-Handler)
+#include <cstddef>    // size_t
+
+#include <cstdint>    // std::uint64_t
+
+#include "profiler.hpp" // Profiler (--profile)
+#include "trace.hpp"    // Tracer (--trace)
+#include "limits.hpp"   // Limits (--max-depth)
+
+namespace interp {
+
+// Schattenstack der gerade laufenden Skript-Einheiten (Funktionen, Methoden, Konstruktoren).
+// Wird in den Aufrufpfaden gepflegt und asynchron vom Sampling-Profiler gelesen;
+// deshalb feste Größe, keine Allokationen und nur atomare Zugriffe.
+struct ShadowStack {
+    static constexpr size_t kCapacity = 1 << 14; // tiefere Frames werden nur gezählt
+
+    std::atomic<const void*> frames[kCapacity];  // Identität der Einheit pro Ebene
+    std::atomic<size_t> depth{0};                // aktuelle Aufruftiefe (kann > kCapacity sein)
+
+    void push(const void* unit) {
+        size_t d = depth.load(std::memory_order_relaxed);
+        if (d < kCapacity) frames[d].store(unit, std::memory_order_relaxed);
+        std::atomic_signal_fence(std::memory_order_release);
+        depth.store(d + 1, std::memory_order_relaxed);
+    }
+
+    // Innerste laufende Einheit (nullptr => ausserhalb aller Aufrufe oder zu tief)
+    const void* top() const {
+        size_t d = depth.load(std::memory_order_relaxed);
+        if (d == 0 || d > kCapacity) return nullptr;
+        return frames[d - 1].load(std::memory_order_relaxed);
+    }
+
+    void pop() {
+        depth.store(depth.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    }
+};
+
+// Prozessweiter Schattenstack
+inline ShadowStack& shadow_stack() {
+    static ShadowStack s;
+    return s;
+}
+
+// RAII fuer einen Skript-Aufruf: pflegt den Schattenstack und meldet den
+// Aufruf an die aktiven Werkzeuge (Profiler, Tracer). Auch bei Exceptions korrekt.
+class CallScope {
+public:
+    explicit CallScope(const void* unit)
+        : unit_(unit), profiled_(profiler().enabled()),
+          trace_start_ns_(tracer().enabled() ? monotonic_ns() : 0) {
+        ShadowStack& ss = shadow_stack();
+        Limits& lim = limits();
+        if (lim.active()) lim.on_call(ss.depth.load(std::memory_order_relaxed) + 1);
+        ss.push(unit);
+        if (profiled_) profiler().enter(unit);
+    }
+
+    ~CallScope() {
+        if (profiled_) profiler().leave();
+        if (trace_start_ns_) tracer().call(unit_, trace_start_ns_, monotonic_ns());
+        shadow_stack().pop();
+    }
+
+    CallScope(const CallScope&) = delete;
+    CallScope& operator=(const CallScope&) = delete;
+
+private:
+    const void* unit_;
+    bool profiled_;
+    std::uint64_t trace_start_ns_; // 0 => ohne --trace
+};
+
+} // namespace interp
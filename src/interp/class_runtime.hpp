@@ -3,14 +3,17 @@
 
 #include <string>           // std::string
 #include <unordered_map>   // Hashmaps fuer schnelle Namensauflösung
+#include <unordered_set>   // std::unordered_set (Klassennamen)
 #include <vector>           // std::vector
 #include <stdexcept>        // std::runtime_error
-#include <algorithm>        // std::reverse
+#include <algorithm>        // std::find
 
 #include "../ast/program.hpp"   // AST-Wurzel (Program)
 #include "../ast/type.hpp"      // Typrepräsentation
 #include "../ast/class.hpp"     // Klassendefinitionen
 #include "../ast/function.hpp"  // Funktionsdefinitionen
+#include "trace.hpp"            // TracePhase (--trace)
+#include "stats.hpp"            // Zähler (--stats)
 
 namespace interp {
 
@@ -19,12 +22,38 @@ struct MethodInfo {
     const ast::MethodDef* def = nullptr; // Pointer in den AST (nach build stabil)
     std::string owner_class;             // Klasse, in der die Methode definiert ist
     bool is_virtual = false;             // Virtual-Flag der Methode
+    std::string key;                     // Signatur (ClassRuntime::sig_key), einmal berechnet
+};
+
+// VTable-Eintrag einer Signatur: aufgelöste Implementierung und ob ein Aufruf über eine
+// Referenz ohne virtuellen Dispatch auskommt (nicht virtuell, oder laut Klassenhierarchie-
+// Analyse genau eine Implementierung in dieser Klasse und allen abgeleiteten)
+struct VtableEntry {
+    const ast::MethodDef* def = nullptr;
+    bool is_virtual = false;
+    bool direct = true;
+};
+
+// Vorberechneter Konstruktionsplan (flach, ohne Overload-Auflösung zur Laufzeit)
+// Ablauf: erst die Default-Ctor-Bodies aller Basen (Base -> Derived), dann der eigene Body
+struct CtorPlan {
+    enum class Kind {
+        User,       // benutzerdefinierter Konstruktor
+        Default,    // synthetischer Default-Konstruktor (leerer Body)
+        Copy        // impliziter Copy-Konstruktor: T(x) mit x vom Typ T oder abgeleitet
+    };
+
+    Kind kind = Kind::Default;
+    const ast::ConstructorDef* ctor = nullptr;   // eigener Konstruktor (nur bei User)
+    std::vector<const ast::Stmt*> base_bodies;   // Default-Ctor-Bodies der Basisklassen
+    std::string error;                           // nicht leer => Plan ist nicht ausfuehrbar
 };
 
 // Metadaten zu einem Konstruktor
 struct CtorInfo {
     const ast::ConstructorDef* def = nullptr; // Pointer in den AST
     std::string owner_class;                  // Klasse, zu der der Konstruktor gehört
+    CtorPlan plan;                            // Konstruktionsplan fuer diesen Konstruktor
 };
 
 // Laufzeit-Informationen zu einer Klasse
@@ -37,6 +66,10 @@ struct ClassInfo {
 
     std::vector<CtorInfo> ctors;              // Alle Konstruktoren der Klasse
 
+    CtorPlan default_plan;                    // Plan fuer T x; bzw. T() (parameterlos)
+    bool has_default_ctor = true;             // false => nur Ctors mit Parametern vorhanden
+    CtorPlan copy_plan;                       // Plan fuer den impliziten Copy-Konstruktor
+
     // Methodenname -> Liste aller Overloads
     std::unordered_map<std::string, std::vector<MethodInfo>> methods;
 
@@ -45,6 +78,9 @@ struct ClassInfo {
 
     // VTable: Signatur -> ob Methode virtuell ist
     std::unordered_map<std::string, bool> vtable_virtual;
+
+    // VTable: Signatur -> Implementierung + Dispatch-Art (resolve_method: ein Lookup)
+    std::unordered_map<std::string, VtableEntry> vtable;
 };
 
 // Zentrale Runtime-Struktur fuer Klassen
@@ -52,6 +88,15 @@ struct ClassRuntime {
     std::unordered_map<std::string, ClassInfo> classes; // Alle Klasseninfos
     const ast::Program* prog = nullptr;                 // Referenz auf AST-Programm
 
+    // Namensindex der Klassendefinitionen (einmal pro build aufgebaut)
+    std::unordered_map<std::string, const ast::ClassDef*> class_defs;
+
+    // Namen aller registrierten Klassen (Typ-Erkennung des Parsers im REPL)
+    std::unordered_set<std::string> class_names;
+
+    // Basisklasse -> direkt abgeleitete Klassen
+    std::unordered_map<std::string, std::vector<std::string>> derived_classes;
+
     // Erzeugt einen eindeutigen Schlüssel fuer Methoden-Signaturen
     static std::string sig_key(const std::string& mname,
                                const std::vector<ast::Param>& params) {
@@ -78,108 +123,292 @@ struct ClassRuntime {
         return k;
     }
 
-    // Sucht eine Klassendefinition im AST
+    // Sucht eine Klassendefinition im AST (ueber den Namensindex)
     const ast::ClassDef* find_class_def(const std::string& name) const {
-        if (!prog) return nullptr;
-        for (const auto& c : prog->classes)
-            if (c.name == name) return &c;
-        return nullptr;
+        auto it = class_defs.find(name);
+        return it != class_defs.end() ? it->second : nullptr;
     }
 
     // Baut alle Runtime-Strukturen aus dem AST auf
+    // Laufzeit linear: Klassen werden einmal indiziert und in topologischer
+    // Reihenfolge (Base vor Derived) aufgebaut, jede Klasse übernimmt die
+    // fertigen Ergebnisse ihrer Basis statt die Kette erneut abzulaufen.
     void build(const ast::Program& p) {
+        TracePhase trace("ClassRuntime::build");
         prog = &p;
         classes.clear();
+        class_defs.clear();
+        class_names.clear();
+        derived_classes.clear();
 
-        // Leere ClassInfo-Strukturen anlegen
+        // Namensindex (bei Duplikaten gewinnt die erste Definition)
+        class_defs.reserve(p.classes.size());
         for (const auto& c : p.classes) {
-            ClassInfo ci;
-            ci.name = c.name;
-            ci.base = c.base_name;
-            classes.emplace(ci.name, std::move(ci));
+            class_defs.emplace(c.name, &c);
+            class_names.insert(c.name);
         }
 
-        // Felder inkl. Vererbung zusammenführen (derived gewinnt)
+        // ClassInfo-Strukturen mit eigenen Konstruktoren und Methoden anlegen
+        classes.reserve(p.classes.size());
         for (const auto& c : p.classes) {
-            auto& ci = classes.at(c.name);
+            if (class_defs.at(c.name) != &c) continue;
+            classes.emplace(c.name, make_class_info(c));
+            if (!c.base_name.empty()) derived_classes[c.base_name].push_back(c.name);
+        }
 
-            std::unordered_map<std::string, ast::Type> merged;
-            std::string cur = c.name;
+        // Vererbungsabhängige Teile in topologischer Reihenfolge
+        for (const auto* def : topological_order())
+            build_inherited(classes.at(def->name), *def);
 
-            while (!cur.empty()) {
-                const ast::ClassDef* def = find_class_def(cur);
-                if (!def) break;
+        analyze_hierarchy();
+    }
 
-                for (const auto& f : def->fields) {
-                    if (merged.find(f.name) == merged.end())
-                        merged.emplace(f.name, f.type);
-                }
-                cur = def->base_name;
-            }
-            ci.merged_fields = std::move(merged);
+    // Registriert eine einzelne neue Klasse (REPL), ohne bestehende Klassen neu aufzubauen.
+    // c muss an einer stabilen Adresse liegen (ast::Program::classes).
+    // Nur Klassen, die bereits von c erben (Basis vorher unbekannt), werden nachgezogen.
+    void add_class(const ast::ClassDef& c) {
+        if (classes.find(c.name) != classes.end())
+            throw std::runtime_error("duplicate class definition: " + c.name);
+
+        class_defs.emplace(c.name, &c);
+        ClassInfo& ci = classes.emplace(c.name, make_class_info(c)).first->second;
+        if (!c.base_name.empty()) derived_classes[c.base_name].push_back(c.name);
+
+        // Zyklus nur möglich, wenn c seine eigene (transitive) Basis ist
+        if (is_same_or_derived(c.base_name, c.name)) {
+            classes.erase(c.name);
+            class_defs.erase(c.name);
+            auto& siblings = derived_classes[c.base_name];
+            siblings.erase(std::find(siblings.begin(), siblings.end(), c.name));
+            throw std::runtime_error("runtime error: inheritance cycle involving: " + c.name);
         }
+        class_names.insert(c.name);
 
-        // Konstruktoren und Methoden sammeln
-        for (const auto& c : p.classes) {
-            auto& ci = classes.at(c.name);
-
-            ci.ctors.clear();
-            for (const auto& ctor : c.ctors) {
-                CtorInfo ci2;
-                ci2.def = &ctor;
-                ci2.owner_class = c.name;
-                ci.ctors.push_back(ci2);
+        build_inherited(ci, c);
+        rebuild_derived(c.name);
+
+        // Die neue Klasse kann Methoden ihrer Basen überschreiben: direkte Aufrufe neu prüfen,
+        // nur für c (samt nachgezogener abgeleiteter Klassen) und seine Basiskette
+        analyze_subtree(ci);
+        for (auto it = classes.find(ci.base); it != classes.end(); it = classes.find(it->second.base))
+            analyze_class(it->second);
+    }
+
+    // Klassenhierarchie-Analyse über alle Klassen (nach build):
+    // abgeleitete Klassen vor ihren Basen, jede Klasse übernimmt das Ergebnis ihrer Kinder
+    void analyze_hierarchy() {
+        auto order = topological_order();
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+            analyze_class(classes.at((*it)->name));
+    }
+
+    // Analysiert alle (transitiv) abgeleiteten Klassen von ci und danach ci selbst
+    void analyze_subtree(ClassInfo& ci) {
+        auto it = derived_classes.find(ci.name);
+        if (it != derived_classes.end()) {
+            for (const auto& d : it->second) {
+                auto dit = classes.find(d);
+                if (dit != classes.end()) analyze_subtree(dit->second);
             }
+        }
+        analyze_class(ci);
+    }
 
-            for (const auto& m : c.methods) {
-                MethodInfo mi;
-                mi.def = &m;
-                mi.owner_class = c.name;
-                mi.is_virtual = m.is_virtual;
-                ci.methods[m.name].push_back(mi);
+    // Direkte Aufrufe einer Klasse aus denen ihrer direkt abgeleiteten Klassen:
+    // eine virtuelle Signatur hat im ganzen Teilbaum genau eine Implementierung, wenn jedes
+    // Kind sie mit demselben Owner direkt aufruft (virtual bleibt in Kindern virtual).
+    // Voraussetzung: die Kinder sind bereits analysiert.
+    void analyze_class(ClassInfo& ci) {
+        auto it = derived_classes.find(ci.name);
+        for (const auto& [key, virt] : ci.vtable_virtual) {
+            VtableEntry& entry = ci.vtable.at(key);
+            entry.is_virtual = virt;
+            entry.direct = !virt;
+            if (!virt) continue;
+            const std::string& owner = ci.vtable_owner.at(key);
+            bool single = true;
+            if (it != derived_classes.end()) {
+                for (const auto& d : it->second) {
+                    auto dit = classes.find(d);
+                    if (dit == classes.end()) continue;
+                    const ClassInfo& dci = dit->second;
+                    auto ito = dci.vtable_owner.find(key);
+                    auto ite = dci.vtable.find(key);
+                    if (ite == dci.vtable.end() || !ite->second.direct ||
+                        ito == dci.vtable_owner.end() || ito->second != owner) {
+                        single = false;
+                        break;
+                    }
+                }
             }
+            entry.direct = single;
         }
+    }
 
-        // Aufbau von VTable-Informationen
-        for (const auto& c : p.classes) {
-            auto& ci = classes.at(c.name);
+    // Aufruf der Signatur key mit statischem Typ static_class braucht keinen virtuellen Dispatch
+    bool dispatch_is_static(const std::string& static_class, const std::string& key) const {
+        const auto& ci = get(static_class);
+        auto it = ci.vtable.find(key);
+        return it == ci.vtable.end() || it->second.direct;
+    }
+
+    // Baut alle (transitiv) abgeleiteten Klassen einer Klasse neu auf
+    void rebuild_derived(const std::string& name) {
+        auto it = derived_classes.find(name);
+        if (it == derived_classes.end()) return;
+
+        for (const auto& d : it->second) {
+            ClassInfo& dci = classes.at(d);
+            const ast::ClassDef& ddef = *class_defs.at(d);
+            dci.merged_fields.clear();
+            dci.vtable_owner.clear();
+            dci.vtable_virtual.clear();
+            dci.vtable.clear();
+            build_inherited(dci, ddef);
+            rebuild_derived(d);
+        }
+    }
+
+    // Legt die ClassInfo einer Klasse an (ohne vererbte Informationen)
+    static ClassInfo make_class_info(const ast::ClassDef& c) {
+        ClassInfo ci;
+        ci.name = c.name;
+        ci.base = c.base_name;
+
+        ci.ctors.reserve(c.ctors.size());
+        for (const auto& ctor : c.ctors) {
+            CtorInfo ci2;
+            ci2.def = &ctor;
+            ci2.owner_class = c.name;
+            ci.ctors.push_back(ci2);
+        }
+
+        for (const auto& m : c.methods) {
+            MethodInfo mi;
+            mi.def = &m;
+            mi.owner_class = c.name;
+            mi.is_virtual = m.is_virtual;
+            mi.key = sig_key(m.name, m.params);
+            ci.methods[m.name].push_back(mi);
+        }
+        return ci;
+    }
+
+    // Liefert alle Klassendefinitionen so sortiert, dass jede Basis vor ihren
+    // abgeleiteten Klassen steht (iterative DFS, erkennt Vererbungszyklen)
+    std::vector<const ast::ClassDef*> topological_order() const {
+        enum class Mark { None, Active, Done };
+        std::unordered_map<std::string, Mark> mark;
+        mark.reserve(class_defs.size());
 
-            // Vererbungskette (Base -> Derived)
-            std::vector<const ast::ClassDef*> chain;
-            const ast::ClassDef* cur = find_class_def(c.name);
+        std::vector<const ast::ClassDef*> order;
+        order.reserve(class_defs.size());
+
+        std::vector<const ast::ClassDef*> pending;
+        for (const auto& c : prog->classes) {
+            if (class_defs.at(c.name) != &c) continue;
+
+            // Kette bis zur ersten bereits erledigten (oder unbekannten) Basis sammeln
+            const ast::ClassDef* cur = &c;
             while (cur) {
-                chain.push_back(cur);
-                if (cur->base_name.empty()) break;
-                cur = find_class_def(cur->base_name);
-            }
-            std::reverse(chain.begin(), chain.end());
-
-            std::unordered_map<std::string, bool> virt;
-            std::unordered_map<std::string, std::string> owner;
-
-            // Virtual-Flags bestimmen
-            for (const auto* d : chain) {
-                for (const auto& m : d->methods) {
-                    std::string k = sig_key(m.name, m.params);
-                    if (virt.find(k) == virt.end())
-                        virt[k] = m.is_virtual;
-                    else if (!virt[k] && m.is_virtual)
-                        virt[k] = true;
-                }
+                Mark& m = mark[cur->name];
+                if (m == Mark::Done) break;
+                if (m == Mark::Active)
+                    throw std::runtime_error("runtime error: inheritance cycle involving: " + cur->name);
+                m = Mark::Active;
+                pending.push_back(cur);
+                cur = cur->base_name.empty() ? nullptr : find_class_def(cur->base_name);
             }
 
-            // Owner der Methoden bestimmen
-            for (const auto* d : chain) {
-                for (const auto& m : d->methods) {
-                    std::string k = sig_key(m.name, m.params);
-                    owner[k] = d->name;
-                    if (m.is_virtual) virt[k] = true;
-                }
+            // Von der Basis zur abgeleiteten Klasse ausgeben
+            while (!pending.empty()) {
+                mark[pending.back()->name] = Mark::Done;
+                order.push_back(pending.back());
+                pending.pop_back();
             }
+        }
+        return order;
+    }
+
+    // Baut Felder, Konstruktionspläne und VTables einer Klasse auf.
+    // Voraussetzung: die Basis (falls vorhanden) ist bereits vollständig aufgebaut.
+    void build_inherited(ClassInfo& ci, const ast::ClassDef& c) {
+        auto bit = ci.base.empty() ? classes.end() : classes.find(ci.base);
+        const ClassInfo* base = (bit != classes.end()) ? &bit->second : nullptr;
 
-            ci.vtable_owner = std::move(owner);
-            ci.vtable_virtual = std::move(virt);
+        // Felder inkl. Vererbung zusammenführen (derived gewinnt)
+        if (base) ci.merged_fields = base->merged_fields;
+        for (const auto& f : c.fields)
+            ci.merged_fields[f.name] = f.type;
+
+        build_ctor_plans(ci, base);
+
+        // VTable: Einträge der Basis übernehmen, eigene Methoden überschreiben
+        // den Owner; einmal virtual bleibt virtual
+        if (base) {
+            ci.vtable_owner = base->vtable_owner;
+            ci.vtable_virtual = base->vtable_virtual;
+            ci.vtable = base->vtable;
+        }
+        for (const auto& m : c.methods) {
+            std::string k = sig_key(m.name, m.params);
+            std::string& owner = ci.vtable_owner[k];
+            if (owner != c.name) ci.vtable[k].def = &m;  // doppelte Signatur: erste Definition
+            owner = c.name;
+            bool& virt = ci.vtable_virtual[k];
+            virt = virt || m.is_virtual;
+        }
+    }
+
+    // Sucht den parameterlosen Konstruktor einer Klasse (nullptr => keiner deklariert)
+    static const ast::ConstructorDef* find_default_ctor(const ClassInfo& ci) {
+        for (const auto& cti : ci.ctors)
+            if (cti.def->params.empty()) return cti.def;
+        return nullptr;
+    }
+
+    // Berechnet User-, Default- und Copy-Plan einer Klasse.
+    // Die Basis-Bodies ergeben sich aus dem (bereits fertigen) Default-Plan der Basis.
+    static void build_ctor_plans(ClassInfo& ci, const ClassInfo* base) {
+        CtorPlan base_plan;
+        if (!ci.base.empty() && !base) {
+            base_plan.error = "runtime error: unknown class: " + ci.base;
+        } else if (base) {
+            base_plan.base_bodies = base->default_plan.base_bodies;
+            base_plan.error = base->default_plan.error;
+
+            if (!base->has_default_ctor)
+                base_plan.error = "runtime error: no matching constructor: " + base->name;
+            else if (base->default_plan.ctor && base->default_plan.ctor->body)
+                base_plan.base_bodies.push_back(base->default_plan.ctor->body.get());
+        }
+
+        for (auto& cti : ci.ctors) {
+            cti.plan = base_plan;
+            cti.plan.kind = CtorPlan::Kind::User;
+            cti.plan.ctor = cti.def;
+        }
+
+        const ast::ConstructorDef* def = find_default_ctor(ci);
+        ci.has_default_ctor = ci.ctors.empty() || def != nullptr;
+        ci.default_plan = std::move(base_plan);
+        ci.default_plan.kind = def ? CtorPlan::Kind::User : CtorPlan::Kind::Default;
+        ci.default_plan.ctor = def;
+
+        ci.copy_plan = CtorPlan{};
+        ci.copy_plan.kind = CtorPlan::Kind::Copy;
+    }
+
+    // Prüft, ob derived == base ist oder (transitiv) von base erbt
+    bool is_same_or_derived(const std::string& derived, const std::string& base) const {
+        std::string cur = derived;
+        while (!cur.empty()) {
+            if (cur == base) return true;
+            auto it = classes.find(cur);
+            if (it == classes.end()) return false;
+            cur = it->second.base;
         }
+        return false;
     }
 
     // Liefert Runtime-Infos einer Klasse oder wirft Fehler
@@ -196,19 +425,20 @@ struct ClassRuntime {
         return t;
     }
 
-    // --- Konstruktor-Overload-Auflösung ---
-    const ast::ConstructorDef& resolve_ctor(const std::string& class_name,
-                                            const std::vector<ast::Type>& arg_types,
-                                            const std::vector<bool>& arg_is_lvalue) const {
+    // --- Konstruktor-Auswahl ---
+    // Liefert den vorberechneten Plan zu den Argumenttypen.
+    // Passt kein benutzerdefinierter Konstruktor und ist das einzige Argument ein Objekt
+    // der Klasse (oder abgeleitet), wird der implizite Copy-Plan geliefert.
+    // nullptr => kein passender Konstruktor (Aufrufer meldet den Fehler).
+    const CtorPlan* find_ctor_plan(const std::string& class_name,
+                                   const std::vector<ast::Type>& arg_types,
+                                   const std::vector<bool>& arg_is_lvalue) const {
         const auto& ci = get(class_name);
 
         // Falls keine Konstruktoren existieren: synthetischer Default
-        if (ci.ctors.empty()) {
-            static ast::ConstructorDef synth;
-            return synth;
-        }
+        if (ci.ctors.empty() && arg_types.empty()) return &ci.default_plan;
 
-        const ast::ConstructorDef* best = nullptr;
+        const CtorPlan* best = nullptr;
 
         for (const auto& cti : ci.ctors) {
             const auto& ctor = *cti.def;
@@ -228,27 +458,33 @@ struct ClassRuntime {
 
             if (!ok) continue;
 
-            if (!best) best = &ctor;
+            if (!best) best = &cti.plan;
             else throw std::runtime_error("runtime error: ambiguous constructor call: " + class_name);
         }
 
-        if (!best)
-            throw std::runtime_error("runtime error: no matching constructor: " + class_name);
-        return *best;
+        if (best) return best;
+
+        // Impliziter Copy-Konstruktor (auch D -> B mit Slicing)
+        if (arg_types.size() == 1 &&
+            arg_types[0].base == ast::Type::Base::Class &&
+            is_same_or_derived(arg_types[0].class_name, class_name)) {
+            return &ci.copy_plan;
+        }
+
+        return nullptr;
     }
 
     // --- Methodenauflösung ---
-    const ast::MethodDef& pick_overload_in_class(const std::string& cls,
-                                                 const std::string& method,
-                                                 const std::vector<ast::Type>& arg_types,
-                                                 const std::vector<bool>& arg_is_lvalue) const {
-        const auto& ci = get(cls);
-
+    // Overload von method in genau dieser Klasse (nullptr => keiner oder mehrdeutig;
+    // mehrdeutige Klassen werden übersprungen, wie in sem::ClassTable::resolve_method_call)
+    const MethodInfo* find_overload_in_class(const ClassInfo& ci,
+                                             const std::string& method,
+                                             const std::vector<ast::Type>& arg_types,
+                                             const std::vector<bool>& arg_is_lvalue) const {
         auto it = ci.methods.find(method);
-        if (it == ci.methods.end())
-            throw std::runtime_error("runtime error: no matching overload: " + method);
+        if (it == ci.methods.end()) return nullptr;
 
-        const ast::MethodDef* best = nullptr;
+        const MethodInfo* best = nullptr;
 
         for (const auto& mi : it->second) {
             const auto& m = *mi.def;
@@ -268,42 +504,10 @@ struct ClassRuntime {
 
             if (!ok) continue;
 
-            if (!best) best = &m;
-            else throw std::runtime_error("runtime error: ambiguous overload: " + method);
+            if (best) return nullptr;
+            best = &mi;
         }
-
-        if (!best)
-            throw std::runtime_error("runtime error: no matching overload: " + method);
-        return *best;
-    }
-
-    // Bestimmt die Klasse, aus der die Methode effektiv aufgerufen wird
-    std::string resolve_owner(const std::string& static_class,
-                              const std::string& dynamic_class,
-                              const ast::MethodDef& picked_sig,
-                              bool call_via_ref) const {
-        std::string key = sig_key(picked_sig.name, picked_sig.params);
-
-        const auto& st = get(static_class);
-        auto itv = st.vtable_virtual.find(key);
-        bool virt = (itv != st.vtable_virtual.end()) ? itv->second : false;
-
-        // Nicht virtuell oder Aufruf nicht ueber Referenz
-        if (!virt || !call_via_ref) {
-            auto ito = st.vtable_owner.find(key);
-            if (ito == st.vtable_owner.end())
-                throw std::runtime_error("runtime error: unknown method: " +
-                                         static_class + "." + picked_sig.name);
-            return ito->second;
-        }
-
-        // Virtueller Aufruf: dynamischer Typ entscheidet
-        const auto& dyn = get(dynamic_class);
-        auto ito = dyn.vtable_owner.find(key);
-        if (ito == dyn.vtable_owner.end())
-            throw std::runtime_error("runtime error: unknown method: " +
-                                     dynamic_class + "." + picked_sig.name);
-        return ito->second;
+        return best;
     }
 
     // Vollständige Methodenauflösung (Overload + Virtual Dispatch)
@@ -313,52 +517,36 @@ struct ClassRuntime {
                                          const std::vector<ast::Type>& arg_types,
                                          const std::vector<bool>& arg_is_lvalue,
                                          bool call_via_ref) const {
-        std::string cur = static_class;
-        std::vector<std::string> chain;
-
-        // Vererbungskette sammeln
-        while (!cur.empty()) {
-            chain.push_back(cur);
-            const auto& ci = get(cur);
-            if (ci.base.empty()) break;
-            cur = ci.base;
+        ++stats().resolve_method_calls;
+        const ClassInfo& st = get(static_class);
+
+        // Overload entlang der Vererbungskette suchen (die nächste Klasse mit Treffer gewinnt)
+        const MethodInfo* picked = nullptr;
+        for (const ClassInfo* ci = &st; ; ci = &get(ci->base)) {
+            picked = find_overload_in_class(*ci, method, arg_types, arg_is_lvalue);
+            if (picked || ci->base.empty()) break;
         }
-
-        const ast::MethodDef* picked = nullptr;
-
-        // Overload in Kette suchen
-        for (const auto& c : chain) {
-            try {
-                picked = &pick_overload_in_class(c, method, arg_types, arg_is_lvalue);
-                break;
-            } catch (...) {
-            }
-        }
-
         if (!picked)
             throw std::runtime_error("runtime error: no matching overload: " + method);
 
-        // Effektiven Owner bestimmen
-        std::string owner = resolve_owner(static_class, dynamic_class,
-                                          *picked, call_via_ref);
-
-        const auto& owner_ci = get(owner);
-        auto it = owner_ci.methods.find(method);
-        if (it == owner_ci.methods.end())
-            throw std::runtime_error("runtime error: missing owner method: " +
-                                     owner + "." + method);
+        auto it = st.vtable.find(picked->key);
+        if (it == st.vtable.end())
+            throw std::runtime_error("runtime error: unknown method: " + static_class + "." + method);
 
-        std::string target_key = sig_key(picked->name, picked->params);
-
-        // Konkrete Implementierung finden
-        for (const auto& mi : it->second) {
-            const auto& m = *mi.def;
-            if (sig_key(m.name, m.params) == target_key)
-                return m;
+        // Nicht virtuell, Aufruf nicht über Referenz oder laut Klassenhierarchie-Analyse
+        // nur eine Implementierung im Teilbaum der statischen Klasse: Eintrag der statischen Klasse
+        const VtableEntry& entry = it->second;
+        if (!call_via_ref || entry.direct) {
+            if (call_via_ref && entry.is_virtual) ++stats().devirtualised_calls;
+            return *entry.def;
         }
 
-        throw std::runtime_error("runtime error: missing override body: " +
-                                 owner + "." + method);
+        // Virtueller Aufruf: dynamischer Typ entscheidet
+        const auto& dyn = get(dynamic_class);
+        auto itd = dyn.vtable.find(picked->key);
+        if (itd == dyn.vtable.end())
+            throw std::runtime_error("runtime error: unknown method: " + dynamic_class + "." + method);
+        return *itd->second.def;
     }
 };
 
@@ -0,0 +1,16 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <chrono>   // std::chrono::steady_clock
+#include <cstdint>  // std::uint64_t
+
+namespace interp {
+
+// Monotone Uhr in Nanosekunden (steady_clock => vDSO, kein Syscall)
+inline std::uint64_t monotonic_ns() {
+    using namespace std::chrono;
+    return static_cast<std::uint64_t>(
+        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace interp
@@ -1,7 +1,11 @@
 #pragma once
 // Verhindert mehrfaches Einbinden dieser Header-Datei
 
+#include <cstddef>          // std::size_t
+#include <memory>           // std::unique_ptr
+#include <new>              // placement new
 #include <string>           // std::string
+#include <vector>           // std::vector
 #include <unordered_map>   // std::unordered_map
 #include <variant>         // std::variant
 #include <stdexcept>       // std::runtime_error
@@ -9,6 +13,7 @@
 #include "value.hpp"       // Laufzeitwerte (Value)
 #include "lvalue.hpp"      // LValue (Variable oder Feldzugriff)
 #include "../ast/type.hpp" // Statischer Typ (ast::Type)
+#include "stats.hpp"       // Zähler (--stats)
 
 namespace interp {
 
@@ -27,12 +32,56 @@ struct RefSlot {
 // Ein Slot ist entweder ein normaler Wert oder eine Referenz
 using Slot = std::variant<VarSlot, RefSlot>;
 
+// Objekte nicht entkommender Klassen-Locals (opt::mark_frame_objects): liegen im Stack-Frame,
+// der den deklarierenden Block ausführt, und leben genau so lange wie dessen Env. Die ersten
+// kInline Objekte liegen direkt hier (auf dem C++-Stack), weitere einzeln auf dem Heap.
+class FrameObjects {
+public:
+    FrameObjects() = default;
+    FrameObjects(const FrameObjects&) = delete;
+    FrameObjects& operator=(const FrameObjects&) = delete;
+
+    ~FrameObjects() {
+        for (std::size_t i = count_; i-- > 0;)
+            reinterpret_cast<Object*>(inline_[i])->~Object();
+    }
+
+    Object& emplace() {
+        if (count_ < kInline) return *new (inline_[count_++]) Object();
+        overflow_.push_back(std::make_unique<Object>());
+        return *overflow_.back();
+    }
+
+    // true, wenn obj eines der Objekte dieses Envs ist
+    bool owns(const Object* obj) const {
+        for (std::size_t i = 0; i < count_; ++i)
+            if (obj == reinterpret_cast<const Object*>(inline_[i])) return true;
+        for (const auto& o : overflow_)
+            if (obj == o.get()) return true;
+        return false;
+    }
+
+private:
+    static constexpr std::size_t kInline = 2;
+
+    alignas(Object) unsigned char inline_[kInline][sizeof(Object)];
+    std::size_t count_ = 0;
+    std::vector<std::unique_ptr<Object>> overflow_;
+};
+
+// Zeiger auf ein Frame-Objekt: besitzt nichts, Kopien zählen keine Referenzen
+inline ObjectPtr frame_object_ptr(Object& obj) {
+    return ObjectPtr(ObjectPtr(), &obj);
+}
+
 // Laufzeit-Umgebung (Scope / Stack-Frame)
 struct Env {
     Env* parent = nullptr;                           // Übergeordnete Umgebung (Scope-Kette)
     std::unordered_map<std::string, Slot> slots;    // Lokale Variablen
+    bool frame_root = false;                         // true => Frame eines Skript-Aufrufs (nicht Block)
+    FrameObjects* objects = nullptr;                 // Frame-Objekte des Blocks (BlockStmt::frame_objects)
 
-    explicit Env(Env* p = nullptr) : parent(p) {}
+    explicit Env(Env* p = nullptr) : parent(p) { ++stats().env_frames; }
 
     // Prüft, ob eine Variable lokal definiert ist
     bool contains_local(const std::string& name) const {
@@ -41,9 +90,13 @@ struct Env {
 
     // Sucht einen Slot in der Scope-Kette
     Slot* find_slot(const std::string& name) {
-        auto it = slots.find(name);
-        if (it != slots.end()) return &it->second;
-        if (parent) return parent->find_slot(name);
+        Stats& st = stats();
+        ++st.slot_lookups;
+        for (Env* e = this; e; e = e->parent) {
+            auto it = e->slots.find(name);
+            if (it != e->slots.end()) return &it->second;
+            ++st.slot_hops;
+        }
         return nullptr;
     }
 
@@ -102,12 +155,47 @@ struct Env {
         Slot* s = find_slot(name);
         if (!s) throw std::runtime_error("undefined variable: " + name);
 
-        if (auto* pv = std::get_if<VarSlot>(s))
+        if (auto* pv = std::get_if<VarSlot>(s)) {
+            if (std::holds_alternative<std::string>(pv->value)) ++stats().string_copies;
             return pv->value;
+        }
 
         return read_lvalue(std::get<RefSlot>(*s).target);
     }
 
+    // Speicherplatz einer Variable (inkl. Dereferenzierung) fuer Lesen/Ändern ohne Kopie
+    Value& storage_of(const std::string& name) {
+        Slot* s = find_slot(name);
+        if (!s) throw std::runtime_error("undefined variable: " + name);
+
+        if (auto* pv = std::get_if<VarSlot>(s)) return pv->value;
+
+        return lvalue_storage(std::get<RefSlot>(*s).target);
+    }
+
+    // Speicherplatz eines LValues (Variable oder Objektfeld)
+    Value& lvalue_storage(const LValue& lv) {
+        if (lv.kind == LValue::Kind::Var) {
+            if (!lv.env) throw std::runtime_error("null lvalue env");
+
+            Slot* s = lv.env->find_slot(lv.name);
+            if (!s) throw std::runtime_error("dangling lvalue: " + lv.name);
+
+            auto* pv = std::get_if<VarSlot>(s);
+            if (!pv)
+                throw std::runtime_error("cannot read from non-value slot: " + lv.name);
+            return pv->value;
+        }
+
+        if (!lv.obj)
+            throw std::runtime_error("null object for field lvalue");
+
+        auto it = lv.obj->fields.find(lv.field);
+        if (it == lv.obj->fields.end())
+            throw std::runtime_error("unknown field at runtime: " + lv.field);
+        return it->second;
+    }
+
     // Weist einer Variable einen neuen Wert zu
     void assign_value(const std::string& name, Value v) {
         Slot* s = find_slot(name);
@@ -160,6 +248,7 @@ struct Env {
             if (!pv)
                 throw std::runtime_error("cannot read from non-value slot: " + lv.name);
 
+            if (std::holds_alternative<std::string>(pv->value)) ++stats().string_copies;
             return pv->value;
         }
 
@@ -171,6 +260,7 @@ struct Env {
         if (it == lv.obj->fields.end())
             throw std::runtime_error("unknown field at runtime: " + lv.field);
 
+        if (std::holds_alternative<std::string>(it->second)) ++stats().string_copies;
         return it->second;
     }
 };
@@ -1,9 +1,12 @@
 #pragma once
 // Verhindert mehrfaches Einbinden dieser Header-Datei
 
+#include <cstdint>     // std::int64_t (JIT-Argumente)
+#include <iostream>    // std::cerr (Heap-Bericht auf SIGUSR1)
+#include <utility>     // std::move (Tail-Calls)
 #include <stdexcept>   // std::runtime_error
+#include <string>      // std::string, std::to_string
 #include <vector>      // std::vector
-#include <iostream>    // std::cout
 
 #include "env.hpp"         // Laufzeit-Umgebung / Scopes
 #include "functions.hpp"   // Funktions- und Klassen-Runtime
@@ -11,18 +14,85 @@
 #include "lvalue.hpp"      // LValue (Variable oder Feld)
 #include "object.hpp"      // Objekt-Repräsentation
 #include "value.hpp"       // Laufzeitwerte
+#include "output.hpp"      // gepufferte Ausgabe der print_*-Builtins
+#include "input.hpp"       // gepufferte Eingabe der read_*-Builtins
+#include "call_stack.hpp"  // CallScope (Schattenstack, --profile)
+#include "line_profiler.hpp" // Zeilenprofil (--line-profile)
+#include "heap_profiler.hpp" // Heap-Profil (--heap-profile)
+#include "call_labels.hpp"   // Namen fuer den Heap-Bericht
+#include "limits.hpp"        // Ausführungslimits (--max-steps, ...)
+#include "exec_options.hpp"  // Laufzeitoptionen (Tail-Calls, ...)
+#include "located_error.hpp" // LocatedError (Fehler mit Quellposition)
+#include "binary_nodes.hpp"  // typspezialisierte Operatoren (opt::specialise_binaries)
+#include "fused_nodes.hpp"   // Superinstruktionen (opt::fuse_superinstructions)
+#include "inline_nodes.hpp"  // Inline-Aufrufe (opt::inline_calls)
+#include "memo.hpp"          // Ergebnis-Caches reiner Funktionen (--memoize)
+#include "../jit/jit.hpp"    // Baseline-JIT fuer int/bool-Funktionen
+#include "../closure/compiler.hpp" // Closure-Engine (--engine=closure)
 #include "../ast/stmt.hpp" // AST Statements
 #include "../ast/expr.hpp" // AST Expressions
 #include "../ast/type.hpp" // AST Typen
 
 namespace interp {
 
-// Signal zum Abbrechen der Ausführung bei return
+// Ziel eines Skript-Aufrufs: freie Funktion oder Methode (mit Objekt)
+struct CallTarget {
+    const ast::FunctionDef* fn = nullptr; // freie Funktion (oder nullptr)
+    const ast::MethodDef* method = nullptr; // Methode (oder nullptr)
+    ObjectPtr self;                       // Objekt bei Methoden
+
+    const void* unit() const { return fn ? static_cast<const void*>(fn) : method; }
+    const ast::Type& return_type() const { return fn ? fn->return_type : method->return_type; }
+    const std::vector<ast::Param>& params() const { return fn ? fn->params : method->params; }
+    const ast::Stmt& body() const { return fn ? *fn->body : *method->body; }
+};
+
+// Vorbereiteter Tail-Call: Ziel + bereits ausgewertete Argumente
+struct TailCall {
+    ast::SourceLoc loc;             // Position des return-Statements (fuer Fehlermeldungen)
+    CallTarget target;
+    std::vector<Value> arg_vals;
+    std::vector<LValue> arg_lvals;
+};
+
+// Ergebnis von exec_stmt: weiter mit dem nächsten Statement oder Body verlassen (return)
+enum class Flow { Normal, Return };
+
+// Daten des zuletzt ausgeführten return-Statements. exec_stmt meldet Flow::Return, der
+// umgebende run_call liest Wert bzw. Tail-Call sofort hier ab; dazwischen läuft kein
+// Skriptcode, daher genügt ein Objekt für alle Aufrufe (ohne Exception, ohne Allokation).
 struct ReturnSignal {
     bool has_value = false; // true wenn "return expr;" genutzt wurde
     Value value;           // Rückgabewert
+    bool tail = false;     // true => "return f(...)" im aktuellen Frame fortsetzen (tail_call)
+    TailCall tail_call;    // Ziel + Argumente (Vektoren werden verschoben, nicht kopiert)
 };
 
+// Prozessweites return-Ergebnis
+inline ReturnSignal& return_signal() {
+    static ReturnSignal rs;
+    return rs;
+}
+
+// "return v;": Wert für den umgebenden run_call ablegen
+inline Flow return_value(Value v) {
+    ReturnSignal& rs = return_signal();
+    rs.has_value = true;
+    rs.value = std::move(v);
+    rs.tail = false;
+    return Flow::Return;
+}
+
+// Bringt einen Laufzeitfehler, der einen Aufruf verlässt, an die Position des innersten
+// laufenden Statements (current_loc). Nur innerhalb eines catch-Blocks aufrufen.
+[[noreturn]] inline void rethrow_located(const std::runtime_error& ex) {
+    const ast::SourceLoc* at = current_loc();
+    if (dynamic_cast<const LocatedError*>(&ex) || dynamic_cast<const LimitExceeded*>(&ex) ||
+        !at || !at->known())
+        throw;
+    throw LocatedError(*at, ex.what());
+}
+
 // C++-ähnliche Wahrheitswert-Konvertierung
 inline bool to_bool_like_cpp(const Value& v) {
     if (auto* pi = std::get_if<int>(&v)) return *pi != 0;
@@ -44,6 +114,17 @@ inline bool expect_bool(const Value& v, const char* ctx) {
     throw std::runtime_error(std::string("type error: expected bool in ") + ctx);
 }
 
+// Liest einen Wert, dessen Typ statisch feststeht (Expr::typed), ohne Typprüfung
+template <class T>
+inline const T& unchecked(const Value& v) {
+    return *std::get_if<T>(&v);
+}
+
+// true, wenn die semantische Analyse den Ausdruck als Basistyp b ausgewiesen hat
+inline bool has_static_type(const ast::Expr& e, ast::Type::Base b) {
+    return e.typed && e.static_type.base == b;
+}
+
 // Leitet statischen Typ aus einem Laufzeitwert ab
 inline ast::Type type_of_value(const Value& v) {
     if (std::holds_alternative<bool>(v)) return ast::Type::Bool(false);
@@ -61,56 +142,52 @@ inline ast::Type type_of_value(const Value& v) {
 inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions);
 
 // Vorwärtsdeklarationen (werden weiter unten definiert)
-inline void exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions);
+inline Flow exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions);
 inline void bind_fields_as_refs_dynamic(Env& method_env,
                                         const ObjectPtr& self,
                                         FunctionTable& functions);
 
-// Ruft einen Konstruktor-Body auf (Felder als Referenzen gebunden)
-inline void run_ctor_body(Env& caller_env,
+// Fuehrt einen vorberechneten Konstruktionsplan aus:
+// Felder werden einmal als Referenzen gebunden, dann laufen die Default-Ctor-Bodies
+// der Basen und zuletzt der eigene Body (mit Parametern) in dieser Umgebung.
+inline void run_ctor_plan(Env& caller_env,
                           const ObjectPtr& self,
-                          const ast::ConstructorDef& ctor,
+                          const CtorPlan& plan,
                           const std::vector<Value>& arg_vals,
                           const std::vector<LValue>& arg_lvals,
                           FunctionTable& functions) {
-    Env ctor_env(&caller_env);
-    bind_fields_as_refs_dynamic(ctor_env, self, functions);
+    if (!plan.error.empty()) throw std::runtime_error(plan.error);
+
+    CallScope scope(&plan);
+
+    // synthetischer Default-CTOR ohne Basis-Bodies: nichts auszufuehren
+    bool has_own_body = plan.ctor && plan.ctor->body;
+    if (plan.base_bodies.empty() && !has_own_body) return;
 
-    for (size_t i = 0; i < ctor.params.size(); ++i) {
-        const auto& p = ctor.params[i];
+    Env fields_env(&caller_env);
+    bind_fields_as_refs_dynamic(fields_env, self, functions);
+
+    // Fehler in den Bodies behalten deren Position (der umgebende Aufruf bringt sie an)
+    const ast::SourceLoc* caller_loc = current_loc();
+
+    // "return;" beendet nur den jeweiligen Body
+    for (const ast::Stmt* body : plan.base_bodies)
+        exec_stmt(fields_env, *body, functions);
+    current_loc() = caller_loc;
+
+    if (!has_own_body) return;
+
+    Env ctor_env(&fields_env);
+    for (size_t i = 0; i < plan.ctor->params.size(); ++i) {
+        const auto& p = plan.ctor->params[i];
         if (p.type.is_ref)
             ctor_env.define_ref(p.name, arg_lvals[i], p.type);
         else
             ctor_env.define_value(p.name, arg_vals[i], p.type);
     }
 
-    // synthetischer Default-CTOR hat leeren Body
-    if (ctor.body) {
-        exec_stmt(ctor_env, *ctor.body, functions);
-    }
-}
-
-// Konstruktoraufruf: erst Base()-Default, dann eigener Body
-inline void run_ctor_chain(Env& caller_env,
-                           const ObjectPtr& self,
-                           const std::string& class_name,
-                           const ast::ConstructorDef& ctor,
-                           const std::vector<Value>& arg_vals,
-                           const std::vector<LValue>& arg_lvals,
-                           FunctionTable& functions) {
-    const auto& ci = functions.class_rt.get(class_name);
-
-    if (!ci.base.empty()) {
-        // Base(): immer parameterloser Default-CTOR
-        std::vector<ast::Type> empty_t;
-        std::vector<bool> empty_lv;
-        const ast::ConstructorDef& base_ctor = functions.class_rt.resolve_ctor(ci.base, empty_t, empty_lv);
-        std::vector<Value> empty_vals;
-        std::vector<LValue> empty_lvals;
-        run_ctor_chain(caller_env, self, ci.base, base_ctor, empty_vals, empty_lvals, functions);
-    }
-
-    run_ctor_body(caller_env, self, ctor, arg_vals, arg_lvals, functions);
+    exec_stmt(ctor_env, *plan.ctor->body, functions);
+    current_loc() = caller_loc;
 }
 
 // Wertet einen Ausdruck als LValue aus
@@ -139,9 +216,38 @@ inline bool is_lvalue_expr(const ast::Expr& e) {
         || dynamic_cast<const ast::MemberAccessExpr*>(&e) != nullptr;
 }
 
+// Ausgewertete Argumente eines Aufrufs (Werte, LValues und Typen fuer die Overload-Auflösung)
+struct CallArgs {
+    std::vector<Value> vals;
+    std::vector<LValue> lvals;
+    std::vector<ast::Type> types;
+    std::vector<bool> is_lv;
+};
+
+// Wertet Argumente von links nach rechts aus
+inline CallArgs eval_call_args(Env& env, const std::vector<ast::ExprPtr>& args, FunctionTable& functions) {
+    CallArgs a;
+    a.vals.reserve(args.size());
+    a.lvals.reserve(args.size());
+    a.types.reserve(args.size());
+    a.is_lv.reserve(args.size());
+
+    for (const auto& ap : args) {
+        bool islv = is_lvalue_expr(*ap);
+        a.is_lv.push_back(islv);
+
+        Value v = eval_expr(env, *ap, functions);
+        a.types.push_back(type_of_value(v));
+        a.vals.push_back(std::move(v));
+
+        if (islv) a.lvals.push_back(eval_lvalue(env, *ap, functions));
+        else a.lvals.push_back(LValue{});
+    }
+    return a;
+}
+
 // Vorwärtsdeklarationen
 inline Value default_value_for_type(const ast::Type& t, FunctionTable& functions);
-inline void exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions);
 
 // Bindet alle Felder des *dynamischen* Objekts als Referenzen
 inline void bind_fields_as_refs_dynamic(Env& method_env,
@@ -155,16 +261,19 @@ inline void bind_fields_as_refs_dynamic(Env& method_env,
     }
 }
 
+// Setzt alle Felder der Klasse auf ihre Default-Werte
+inline void init_default_fields(Object& obj, const ClassInfo& ci, FunctionTable& functions) {
+    for (const auto& kv : ci.merged_fields) {
+        obj.fields[kv.first] = default_value_for_type(kv.second, functions);
+    }
+}
+
 // Allokiert ein Objekt mit Default-Feldern
 inline ObjectPtr allocate_object_with_default_fields(const std::string& class_name,
                                                      FunctionTable& functions) {
-    auto obj = std::make_shared<Object>();
-    obj->dynamic_class = class_name;
-
     const auto& ci = functions.class_rt.get(class_name);
-    for (const auto& kv : ci.merged_fields) {
-        obj->fields[kv.first] = default_value_for_type(kv.second, functions);
-    }
+    ObjectPtr obj = make_object(class_name, ci.merged_fields.size());
+    init_default_fields(*obj, ci, functions);
     return obj;
 }
 
@@ -205,64 +314,318 @@ inline Value copy_class_value_for_static_type(const Value& v,
     return copied;
 }
 
-// Builtin-Funktionen (print_*)
+// Führt den Default-Konstruktor (falls vorhanden) auf obj aus
+inline void run_default_ctor(Env& env, const ObjectPtr& obj, const ClassInfo& ci, FunctionTable& functions) {
+    if (ci.has_default_ctor) {
+        std::vector<Value> no_vals;
+        std::vector<LValue> no_lvals;
+        run_ctor_plan(env, obj, ci.default_plan, no_vals, no_lvals, functions);
+    }
+}
+
+// Default-Konstruktion eines Klassenwerts (T x;): Default-Felder + Default-Plan
+inline Value construct_default_object(Env& env, const std::string& class_name, FunctionTable& functions) {
+    ObjectPtr obj = allocate_object_with_default_fields(class_name, functions);
+    run_default_ctor(env, obj, functions.class_rt.get(class_name), functions);
+    return Value{obj};
+}
+
+// Klassen-Local ohne Escape (opt::mark_frame_objects): das Objekt liegt in den FrameObjects
+// des deklarierenden Blocks statt auf dem Heap; die Variable hält einen nicht besitzenden
+// Zeiger darauf.
+// Initialisierung wie bei Heap-Objekten: Default-Konstruktion bzw. tiefe Kopie (+ Slicing);
+// T x = T(args) wird direkt im Env konstruiert (ohne Temporärobjekt und Kopie).
+inline Value construct_frame_object(Env& env, const ast::VarDeclStmt& v, FunctionTable& functions) {
+    const ast::Type& t = v.decl_type;
+    auto emplace = [&]() {
+        Object& obj = env.objects->emplace();
+        obj.dynamic_class = t.class_name;
+        ++stats().frame_objects;
+        return frame_object_ptr(obj);
+    };
+
+    if (!v.init) {
+        ObjectPtr self = emplace();
+        const auto& ci = functions.class_rt.get(t.class_name);
+        init_default_fields(*self, ci, functions);
+        run_default_ctor(env, self, ci, functions);
+        return Value{std::move(self)};
+    }
+
+    Value init;
+    auto* ce = dynamic_cast<const ast::ConstructExpr*>(v.init.get());
+    if (ce && ce->class_name == t.class_name) {
+        CallArgs args = eval_call_args(env, ce->args, functions);
+        const CtorPlan* plan = functions.class_rt.find_ctor_plan(ce->class_name, args.types, args.is_lv);
+        if (!plan)
+            throw std::runtime_error("runtime error: no matching constructor: " + ce->class_name);
+        if (plan->kind != CtorPlan::Kind::Copy) {
+            ObjectPtr self = emplace();
+            init_default_fields(*self, functions.class_rt.get(t.class_name), functions);
+            run_ctor_plan(env, self, *plan, args.vals, args.lvals, functions);
+            return Value{std::move(self)};
+        }
+        init = std::move(args.vals[0]); // T x = T(y) wie T x = y
+    } else {
+        init = eval_expr(env, *v.init, functions);
+    }
+
+    auto* src = std::get_if<ObjectPtr>(&init);
+    if (!src || !*src) throw std::runtime_error("expected object value");
+    ObjectPtr self = emplace();
+    ++stats().object_deep_copies;
+    for (const auto& [k, vv] : (*src)->fields) self->fields[k] = deep_copy_value(vv);
+    if ((*src)->dynamic_class != t.class_name)
+        self->slice_to(t.class_name, functions.class_rt.get(t.class_name).merged_fields);
+    return Value{std::move(self)};
+}
+
+// Builtin-Funktionen (print_*, read_*, has_*)
 inline Value call_builtin(const std::string& name, const std::vector<Value>& args) {
     if (name == "print_int") {
-        std::cout << expect_int(args.at(0), "print_int") << "\n";
+        output().write_int_line(expect_int(args.at(0), "print_int"));
         return Value{0};
     }
     if (name == "print_bool") {
         bool b = expect_bool(args.at(0), "print_bool");
-        std::cout << (b ? 1 : 0) << "\n";
+        output().write_int_line(b ? 1 : 0);
         return Value{0};
     }
     if (name == "print_char") {
         auto* pc = std::get_if<char>(&args.at(0));
         if (!pc) throw std::runtime_error("type error: expected char in print_char");
-        std::cout << *pc << "\n";
+        output().write_char_line(*pc);
         return Value{0};
     }
     if (name == "print_string") {
         auto* ps = std::get_if<std::string>(&args.at(0));
         if (!ps) throw std::runtime_error("type error: expected string in print_string");
-        std::cout << *ps << "\n";
+        output().write_string_line(*ps);
         return Value{0};
     }
+
+    // Eingabe: alle read_*/has_* sind parameterlos
+    if (!args.empty())
+        throw std::runtime_error("type error: " + name + " expects no arguments");
+    if (name == "read_int")  return Value{input().read_int()};
+    if (name == "read_char") return Value{input().read_char()};
+    if (name == "read_line") return Value{input().read_line()};
+    if (name == "has_input") return Value{input().has_input()};
+    if (name == "has_int")   return Value{input().has_int()};
     throw std::runtime_error("unknown builtin: " + name);
 }
 
-// Aufruf einer freien Funktion
-inline Value call_function(Env& caller_env,
-                           ast::FunctionDef& f,
-                           const std::vector<Value>& arg_vals,
-                           const std::vector<LValue>& arg_lvals,
-                           FunctionTable& functions) {
-    Env callee(&caller_env);
+// Builtin-Aufruf mit statisch geprüften Argumenten (Typen stehen fest, keine LValues nötig)
+inline Value call_builtin_typed(Env& env, const ast::CallExpr& c, FunctionTable& functions) {
+    const std::string& name = c.callee;
+    if (c.args.empty()) return call_builtin(name, {});
 
-    // Parameter binden
-    for (size_t i = 0; i < f.params.size(); ++i) {
-        const auto& p = f.params[i];
-        if (p.type.is_ref)
-            callee.define_ref(p.name, arg_lvals[i], p.type);
-        else
-            callee.define_value(p.name, arg_vals[i], p.type);
+    Value arg = eval_expr(env, *c.args[0], functions);
+    if (name == "print_int") {
+        output().write_int_line(unchecked<int>(arg));
+    } else if (name == "print_bool") {
+        output().write_int_line(unchecked<bool>(arg) ? 1 : 0);
+    } else if (name == "print_char") {
+        output().write_char_line(unchecked<char>(arg));
+    } else if (name == "print_string") {
+        output().write_string_line(unchecked<std::string>(arg));
+    } else {
+        return call_builtin(name, {arg});
     }
+    return Value{0};
+}
 
-    try {
-        exec_stmt(callee, *f.body, functions);
-    } catch (const ReturnSignal& rs) {
-        if (f.return_type.base == ast::Type::Base::Void) {
-            if (rs.has_value)
-                throw std::runtime_error("type error: void function must not return a value");
+// Wertet eine Bedingung aus (if/while/&&/||); bool-typisierte Ausdrücke ohne Typprüfung
+inline bool eval_condition(Env& env, const ast::Expr& e, FunctionTable& functions) {
+    Value v = eval_expr(env, e, functions);
+    if (has_static_type(e, ast::Type::Base::Bool)) return unchecked<bool>(v);
+    return to_bool_like_cpp(v);
+}
+
+// Vergleich statisch typisierter Operanden (int oder char, von sem geprüft)
+template <class Cmp>
+inline Value compare_typed(const ast::BinaryExpr& b, const Value& lv, const Value& rv, Cmp cmp) {
+    if (b.left->static_type.base == ast::Type::Base::Char)
+        return Value{cmp(unchecked<char>(lv), unchecked<char>(rv))};
+    return Value{cmp(unchecked<int>(lv), unchecked<int>(rv))};
+}
+
+// Gleichheit statisch typisierter Operanden (gleicher primitiver Typ, von sem geprüft)
+inline bool equal_typed(const ast::BinaryExpr& b, const Value& lv, const Value& rv) {
+    switch (b.left->static_type.base) {
+        case ast::Type::Base::Int:  return unchecked<int>(lv) == unchecked<int>(rv);
+        case ast::Type::Base::Bool: return unchecked<bool>(lv) == unchecked<bool>(rv);
+        case ast::Type::Base::Char: return unchecked<char>(lv) == unchecked<char>(rv);
+        default:                    return unchecked<std::string>(lv) == unchecked<std::string>(rv);
+    }
+}
+
+// Ruft eine vom JIT übersetzte Funktion auf (Parameter sind int/bool ohne Referenz)
+inline Value call_compiled(const jit::Compiled& code, const ast::FunctionDef& f,
+                           const std::vector<Value>& arg_vals) {
+    std::int64_t raw[16];
+    std::vector<std::int64_t> many;
+    std::int64_t* args = raw;
+    if (arg_vals.size() > 16) {
+        many.resize(arg_vals.size());
+        args = many.data();
+    }
+    for (size_t i = 0; i < arg_vals.size(); ++i) {
+        if (auto* pi = std::get_if<int>(&arg_vals[i])) args[i] = *pi;
+        else args[i] = unchecked<bool>(arg_vals[i]) ? 1 : 0;
+    }
+
+    ++stats().jit_calls;
+    jit::JitContext ctx;
+    if (code.entry(&ctx, args) != 0) {
+        const jit::ErrorSite& site = jit::jit().site(ctx.site);
+        throw LocatedError(site.loc, site.message ? site.message : ctx.error);
+    }
+
+    switch (f.return_type.base) {
+        case ast::Type::Base::Int:  return Value{static_cast<int>(ctx.result)};
+        case ast::Type::Base::Bool: return Value{(ctx.result & 0xFFFFFFFF) != 0};
+        default:                    return Value{0};
+    }
+}
+
+inline Value invoke(Env& caller_env,
+                    CallTarget target,
+                    const std::vector<Value>* arg_vals,
+                    const std::vector<LValue>* arg_lvals,
+                    FunctionTable& functions);
+
+// Führt einen Skript-Aufruf aus. Tail-Calls ("return g(...);") des aufgerufenen Bodys
+// werden hier als Schleife fortgesetzt: der Frame wird abgebaut und durch den des Ziels
+// ersetzt, d.h. Tail-Rekursion läuft mit konstantem Stack- und Speicherbedarf.
+// Laufzeitfehler des Bodys erhalten hier die Position ihres Statements; Fehler nach dem
+// Body (Rückgabetyp) gehören wie die Argumente zum Statement des Aufrufers.
+inline Value run_call(Env& caller_env,
+                      CallTarget target,
+                      const std::vector<Value>* arg_vals,
+                      const std::vector<LValue>* arg_lvals,
+                      FunctionTable& functions) {
+    TailCall pending; // Ziel + Argumente des laufenden Tail-Calls (aus return_signal() übernommen)
+    const ast::SourceLoc* caller_loc = current_loc();
+
+    for (;;) {
+        // int/bool-Funktionen laufen, wenn möglich, als Maschinencode
+        if (target.fn && exec_options().jit) {
+            if (const jit::Compiled* code = jit::jit().find(*target.fn, functions))
+                return call_compiled(*code, *target.fn, *arg_vals);
+        }
+        // sonst, mit --engine=closure, als vorab übersetzter Closure-Baum
+        if (target.fn && exec_options().engine == Engine::Closure) {
+            if (const closure::CompiledFunction* cf = closure::engine().find(*target.fn, functions))
+                return cf->call(*arg_vals, caller_env, functions);
+        }
+
+        const ast::Type& ret = target.return_type();
+        const char* what = target.fn ? "function" : "method";
+
+        CallScope scope(target.unit());
+        Env frame(&caller_env);
+        frame.frame_root = true;
+
+        // Felder des dynamischen Objekts binden
+        if (target.method) bind_fields_as_refs_dynamic(frame, target.self, functions);
+
+        // Parameter binden
+        const auto& params = target.params();
+        for (size_t i = 0; i < params.size(); ++i) {
+            const auto& p = params[i];
+            if (p.type.is_ref)
+                frame.define_ref(p.name, (*arg_lvals)[i], p.type);
+            else
+                frame.define_value(p.name, (*arg_vals)[i], p.type);
+        }
+
+        Flow flow = Flow::Normal;
+        try {
+            flow = exec_stmt(frame, target.body(), functions);
+        } catch (const std::runtime_error& ex) {
+            rethrow_located(ex);
+        }
+        current_loc() = caller_loc;
+
+        // Kein expliziter return
+        if (flow == Flow::Normal) {
+            if (ret.base == ast::Type::Base::Void) return Value{0};
+            return default_value_for_type(ret, functions);
+        }
+
+        ReturnSignal& rs = return_signal();
+        const bool has_value = rs.has_value;
+        Value result;
+        if (rs.tail) {
+            // Gleicher (nicht-void) Rückgabetyp: Frame wiederverwenden.
+            // "return g();" in void-Funktionen bleibt ein Fehler nach dem Aufruf.
+            if (ret.base != ast::Type::Base::Void && rs.tail_call.target.return_type() == ret) {
+                pending = std::move(rs.tail_call);
+                target = std::move(pending.target);
+                arg_vals = &pending.arg_vals;
+                arg_lvals = &pending.arg_lvals;
+                ++stats().tail_calls;
+                continue;
+            }
+            // Sonst: gewöhnlicher Aufruf aus dem noch lebenden Frame
+            // (Fehler erhalten die Position des return-Statements wie ohne Tail-Call)
+            TailCall call = std::move(rs.tail_call);
+            try {
+                result = invoke(frame, std::move(call.target), &call.arg_vals, &call.arg_lvals, functions);
+            } catch (const LocatedError&) {
+                throw;
+            } catch (const LimitExceeded&) {
+                throw;
+            } catch (const std::runtime_error& ex) {
+                throw LocatedError(call.loc, ex.what());
+            }
+        } else if (has_value) {
+            result = std::move(rs.value);
+        }
+
+        if (ret.base == ast::Type::Base::Void) {
+            if (has_value)
+                throw std::runtime_error(std::string("type error: void ") + what +
+                                         " must not return a value");
             return Value{0};
         }
-        if (!rs.has_value)
-            throw std::runtime_error("type error: non-void function must return a value");
-        return rs.value;
+        if (!has_value)
+            throw std::runtime_error(std::string("type error: non-void ") + what +
+                                     " must return a value");
+        return result;
+    }
+}
+
+// Skript-Aufruf; mit --memoize liefern reine Funktionen bekannte Ergebnisse aus dem Cache.
+// Rekursive gecachte Funktionen laufen nie als JIT-/Closure-Code, damit auch die inneren
+// Aufrufe hier vorbeikommen (jit::Jit und closure::Engine lehnen sie ab); andere reine
+// Funktionen laufen nach einem Fehlschlag kompiliert.
+inline Value invoke(Env& caller_env,
+                    CallTarget target,
+                    const std::vector<Value>* arg_vals,
+                    const std::vector<LValue>* arg_lvals,
+                    FunctionTable& functions) {
+    if (target.fn) {
+        if (MemoTable* table = memo().find(*target.fn)) {
+            if (const Value* hit = table->lookup(*arg_vals)) return *hit;
+            Value result = run_call(caller_env, std::move(target), arg_vals, arg_lvals, functions);
+            table->store(*arg_vals, result);
+            return result;
+        }
     }
-    // Kein expliziter return
-    if (f.return_type.base == ast::Type::Base::Void) return Value{0};
-    return default_value_for_type(f.return_type, functions);
+    return run_call(caller_env, std::move(target), arg_vals, arg_lvals, functions);
+}
+
+// Aufruf einer freien Funktion
+inline Value call_function(Env& caller_env,
+                           const ast::FunctionDef& f,
+                           const std::vector<Value>& arg_vals,
+                           const std::vector<LValue>& arg_lvals,
+                           FunctionTable& functions) {
+    CallTarget target;
+    target.fn = &f;
+    return invoke(caller_env, std::move(target), &arg_vals, &arg_lvals, functions);
 }
 
 // Aufruf einer Methode
@@ -275,46 +638,135 @@ inline Value call_method(Env& caller_env,
                          FunctionTable& functions) {
     (void)static_class;
 
-    Env method_env(&caller_env);
+    CallTarget target;
+    target.method = &m;
+    target.self = self;
+    return invoke(caller_env, std::move(target), &arg_vals, &arg_lvals, functions);
+}
 
-    // Felder des dynamischen Objekts binden
-    bind_fields_as_refs_dynamic(method_env, self, functions);
+// Bestimmt die Zielmethode von obj.m(args) (statischer Typ + virtueller Dispatch)
+inline CallTarget resolve_method_call(Env& env,
+                                      const ast::MethodCallExpr& mc,
+                                      const ObjectPtr& self,
+                                      const CallArgs& args,
+                                      FunctionTable& functions) {
+    // Statischer Typ + call_via_ref bestimmen (Polymorphie nur ueber Referenzen)
+    std::string static_class = self->dynamic_class;
+    bool call_via_ref = false;
+
+    if (auto* ve = dynamic_cast<const ast::VarExpr*>(mc.object.get())) {
+        ast::Type st = env.static_type_of(ve->name);
+        if (st.base == ast::Type::Base::Class) static_class = st.class_name;
+        call_via_ref = env.is_ref_var(ve->name);
+    }
 
-    // Parameter binden
-    for (size_t i = 0; i < m.params.size(); ++i) {
-        const auto& p = m.params[i];
-        if (p.type.is_ref)
-            method_env.define_ref(p.name, arg_lvals[i], p.type);
-        else
-            method_env.define_value(p.name, arg_vals[i], p.type);
+    CallTarget target;
+    target.method = &functions.class_rt.resolve_method(
+        static_class,
+        self->dynamic_class,
+        mc.method,
+        args.types,
+        args.is_lv,
+        call_via_ref
+    );
+    target.self = self;
+    return target;
+}
+
+// Wertet das Objekt eines Methodenaufrufs aus
+inline ObjectPtr eval_method_receiver(Env& env, const ast::MethodCallExpr& mc, FunctionTable& functions) {
+    Value objv = eval_expr(env, *mc.object, functions);
+    auto* pobj = std::get_if<ObjectPtr>(&objv);
+    if (!pobj || !*pobj)
+        throw std::runtime_error("method call on non-object");
+    return *pobj;
+}
+
+// true, wenn obj ein Frame-Objekt des Frames ist, zu dem env gehört (Frame-Wurzel inklusive)
+inline bool object_in_frame(const ObjectPtr& obj, const Env& env) {
+    if (!obj || obj.use_count() != 0) return false; // Heap-Objekte hält der Zeiger selbst
+    for (const Env* e = &env; e; e = e->parent) {
+        if (e->objects && e->objects->owns(obj.get())) return true;
+        if (e->frame_root) break;
     }
+    return false;
+}
 
-    try {
-        exec_stmt(method_env, *m.body, functions);
-    } catch (const ReturnSignal& rs) {
-        if (m.return_type.base == ast::Type::Base::Void) {
-            if (rs.has_value)
-                throw std::runtime_error("type error: void method must not return a value");
-            return Value{0};
-        }
-        if (!rs.has_value)
-            throw std::runtime_error("type error: non-void method must return a value");
-        return rs.value;
+// true, wenn ein LValue in den Frame zeigt, zu dem env gehört (Frame-Wurzel inklusive)
+inline bool lvalue_in_frame(const LValue& lv, const Env& env) {
+    if (lv.kind == LValue::Kind::Field) return object_in_frame(lv.obj, env);
+    for (const Env* e = &env; e; e = e->parent) {
+        if (e == lv.env) return true;
+        if (e->frame_root) break;
+    }
+    return false;
+}
+
+// "return f(args);" / "return obj.m(args);" in Tail-Position:
+// Ziel und Argumente werden hier ausgewertet und als Tail-Call an run_call gemeldet.
+// Bindet ein Referenzparameter ein LValue im aktuellen Frame (der abgebaut würde) oder ist
+// der Empfänger ein Frame-Objekt dieses Frames, wird stattdessen gewöhnlich aufgerufen.
+// return_signal() wird erst am Ende beschrieben: die Argumente können selbst Aufrufe enthalten.
+inline Flow exec_tail_return(Env& env, const ast::ReturnStmt& ret, FunctionTable& functions) {
+    const ast::Expr& value = *ret.value;
+    CallTarget target;
+    CallArgs args;
+
+    if (auto* c = dynamic_cast<const ast::CallExpr*>(&value)) {
+        if (is_builtin(c->callee)) return return_value(eval_expr(env, value, functions));
+        args = eval_call_args(env, c->args, functions);
+        target.fn = &functions.resolve(c->callee, args.types, args.is_lv);
+    } else if (auto* mc = dynamic_cast<const ast::MethodCallExpr*>(&value)) {
+        ObjectPtr self = eval_method_receiver(env, *mc, functions);
+        args = eval_call_args(env, mc->args, functions);
+        target = resolve_method_call(env, *mc, self, args, functions);
+    } else {
+        return return_value(eval_expr(env, value, functions));
     }
-    if (m.return_type.base == ast::Type::Base::Void) return Value{0};
-    return default_value_for_type(m.return_type, functions);
+
+    if (object_in_frame(target.self, env))
+        return return_value(invoke(env, std::move(target), &args.vals, &args.lvals, functions));
+
+    const auto& params = target.params();
+    for (size_t i = 0; i < params.size(); ++i) {
+        // Wertparameter erhalten args.vals; nur Referenzen binden das LValue selbst
+        if (params[i].type.is_ref && lvalue_in_frame(args.lvals[i], env))
+            return return_value(invoke(env, std::move(target), &args.vals, &args.lvals, functions));
+    }
+
+    ReturnSignal& rs = return_signal();
+    rs.has_value = true;
+    rs.tail = true;
+    rs.tail_call.loc = ret.loc;
+    rs.tail_call.target = std::move(target);
+    rs.tail_call.arg_vals = std::move(args.vals);
+    rs.tail_call.arg_lvals = std::move(args.lvals);
+    return Flow::Return;
+}
+
+// Block mit Frame-Objekten: deren Speicher liegt nur im Stack-Frame dieser (nicht inline
+// erweiterten) Funktion, gewöhnliche Blöcke und Aufruf-Frames bleiben klein
+[[gnu::noinline]] inline Flow exec_block_with_frame_objects(Env& env, const ast::BlockStmt& b,
+                                                           FunctionTable& functions) {
+    FrameObjects objects;
+    Env local(&env);
+    local.objects = &objects;
+    for (auto& st : b.statements)
+        if (exec_stmt(local, *st, functions) == Flow::Return) return Flow::Return;
+    return Flow::Normal;
 }
 
-// Ausführung eines Statements
-inline void exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions) {
+// Ausführung eines Statements nach seiner Art (Position und Werkzeuge: exec_stmt)
+inline Flow exec_stmt_unlocated(Env& env, const ast::Stmt& s, FunctionTable& functions) {
     using namespace ast;
 
     // Block
     if (auto* b = dynamic_cast<const BlockStmt*>(&s)) {
+        if (b->frame_objects) return exec_block_with_frame_objects(env, *b, functions);
         Env local(&env);
         for (auto& st : b->statements)
-            exec_stmt(local, *st, functions);
-        return;
+            if (exec_stmt(local, *st, functions) == Flow::Return) return Flow::Return;
+        return Flow::Normal;
     }
 
     // Variablendeklaration
@@ -326,63 +778,116 @@ inline void exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions) {
                 throw std::runtime_error("Referenzvariable muss initialisiert werden");
             LValue target = eval_lvalue(env, *v->init, functions);
             env.define_ref(v->name, target, t);
+        } else if (v->frame_object && env.objects) {
+            env.define_value(v->name, construct_frame_object(env, *v, functions), t);
         } else {
             Value init;
-            if (v->init)
+            if (v->init) {
                 init = eval_expr(env, *v->init, functions);
-            else
-                init = default_value_for_type(t, functions);
 
-            // Klassenwerte sind Werte: deep copy + ggf. slicing zum statischen Typ
-            if (t.base == ast::Type::Base::Class)
-                init = copy_class_value_for_static_type(init, t, functions);
+                // Klassenwerte sind Werte: deep copy + ggf. slicing zum statischen Typ
+                if (t.base == ast::Type::Base::Class)
+                    init = copy_class_value_for_static_type(init, t, functions);
+            } else if (t.base == ast::Type::Base::Class) {
+                init = construct_default_object(env, t.class_name, functions);
+            } else {
+                init = default_value_for_type(t, functions);
+            }
 
             env.define_value(v->name, init, t);
         }
-        return;
+        return Flow::Normal;
     }
 
     // Ausdrucksstatement
     if (auto* e = dynamic_cast<const ExprStmt*>(&s)) {
         eval_expr(env, *e->expr, functions);
-        return;
+        return Flow::Normal;
     }
 
     // If
     if (auto* i = dynamic_cast<const IfStmt*>(&s)) {
-        bool cond = to_bool_like_cpp(eval_expr(env, *i->cond, functions));
-        if (cond) exec_stmt(env, *i->then_branch, functions);
-        else if (i->else_branch) exec_stmt(env, *i->else_branch, functions);
-        return;
+        bool cond = eval_condition(env, *i->cond, functions);
+        if (cond) return exec_stmt(env, *i->then_branch, functions);
+        if (i->else_branch) return exec_stmt(env, *i->else_branch, functions);
+        return Flow::Normal;
     }
 
     // While
     if (auto* w = dynamic_cast<const WhileStmt*>(&s)) {
-        while (to_bool_like_cpp(eval_expr(env, *w->cond, functions)))
-            exec_stmt(env, *w->body, functions);
-        return;
+        while (eval_condition(env, *w->cond, functions)) {
+            if (exec_stmt(env, *w->body, functions) == Flow::Return) return Flow::Return;
+            current_loc() = &s.loc; // Fehler in der Bedingung gehören zum while
+        }
+        return Flow::Normal;
     }
 
-    // Return
+    // Return: Wert bzw. Tail-Call in return_signal(), run_call übernimmt
     if (auto* r = dynamic_cast<const ReturnStmt*>(&s)) {
-        ReturnSignal rs;
-        if (r->value) {
-            rs.has_value = true;
-            rs.value = eval_expr(env, *r->value, functions);
-        } else {
-            rs.has_value = false;
-            rs.value = Value{0};
-        }
-        throw rs;
+        ++stats().returns;
+        if (r->value && r->tail_call && exec_options().tail_calls)
+            return exec_tail_return(env, *r, functions);
+        if (r->value) return return_value(eval_expr(env, *r->value, functions));
+
+        ReturnSignal& rs = return_signal();
+        rs.has_value = false;
+        rs.tail = false;
+        return Flow::Return;
     }
 
     throw std::runtime_error("unknown statement");
 }
 
+// Werkzeuge pro Statement: Zeilenprofil, SIGUSR1-Anforderung des Heap-Profils, Schrittlimit.
+// Nur bei ExecOptions::statement_hooks aufgerufen; ausser Linie, damit exec_stmt klein bleibt.
+[[gnu::noinline]] inline void on_statement(const ast::Stmt& s, const FunctionTable& functions) {
+    LineProfiler& lp = line_profiler();
+    if (lp.enabled() && !dynamic_cast<const ast::BlockStmt*>(&s)) lp.hit(s.loc.line);
+
+    if (heap_profiler().enabled() && HeapProfiler::take_dump_request())
+        heap_profiler().write_text(std::cerr, build_call_labels(functions));
+
+    Limits& lim = limits();
+    if (lim.active()) lim.on_step();
+}
+
+// Ausführung eines Statements. Vermerkt nur dessen Position: Laufzeitfehler erhalten sie
+// erst beim Verlassen des Aufrufs (run_call), ohne Exception-Handler pro Statement.
+// Aus derselben Position liest der Heap-Profiler die Zeile neuer Objekte.
+inline Flow exec_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions) {
+    current_loc() = &s.loc;
+    if (exec_options().statement_hooks) on_statement(s, functions);
+    return exec_stmt_unlocated(env, s, functions);
+}
+
+// Statement ausserhalb eines Skript-Aufrufs (REPL): Fehler erhalten hier ihre Position
+inline Flow exec_top_level_stmt(Env& env, const ast::Stmt& s, FunctionTable& functions) {
+    current_loc() = nullptr;
+    try {
+        return exec_stmt(env, s, functions);
+    } catch (const std::runtime_error& ex) {
+        rethrow_located(ex);
+    }
+}
+
 // Ausdrucksauswertung
 inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
     using namespace ast;
 
+    // Nach der Typprüfung spezialisierter Operator, Superinstruktion bzw. Inline-Aufruf: direkte
+    // Operation ohne Knoten-, Typ- und Operator-Fallunterscheidung (typed fällt weg, sobald der
+    // REPL neue Definitionen ergänzt; dann gilt der allgemeine Weg unten)
+    if (e.typed) {
+        switch (e.specialised) {
+            case Expr::Specialised::Binary: return static_cast<const SpecialisedBinary&>(e).eval(env, functions);
+            case Expr::Specialised::Assign: return static_cast<const FusedAssign&>(e).eval(env, functions);
+            case Expr::Specialised::Inline: return static_cast<const InlineNode&>(e).eval(env, functions);
+            case Expr::Specialised::InlinedCall: return static_cast<const InlinedCall&>(e).eval(env, functions);
+            case Expr::Specialised::InlinedMethod: return static_cast<const InlinedMethodCall&>(e).eval(env, functions);
+            case Expr::Specialised::No:     break;
+        }
+    }
+
     // Literale
     if (auto* i = dynamic_cast<const IntLiteral*>(&e)) return i->value;
     if (auto* b = dynamic_cast<const BoolLiteral*>(&e)) return b->value;
@@ -396,6 +901,10 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
     // Unär
     if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) {
         Value v = eval_expr(env, *u->expr, functions);
+        if (u->expr->typed) {
+            if (u->op == UnaryExpr::Op::Neg) return Value{ -unchecked<int>(v) };
+            return Value{ !unchecked<bool>(v) };
+        }
         if (u->op == UnaryExpr::Op::Neg) {
             return Value{ -expect_int(v, "unary -") };
         }
@@ -409,36 +918,46 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
     if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
         // Short-circuit fuer && / ||
         if (b->op == BinaryExpr::Op::AndAnd) {
-            bool left = to_bool_like_cpp(eval_expr(env, *b->left, functions));
+            bool left = eval_condition(env, *b->left, functions);
             if (!left) return Value{false};
-            bool right = to_bool_like_cpp(eval_expr(env, *b->right, functions));
+            bool right = eval_condition(env, *b->right, functions);
             return Value{right};
         }
         if (b->op == BinaryExpr::Op::OrOr) {
-            bool left = to_bool_like_cpp(eval_expr(env, *b->left, functions));
+            bool left = eval_condition(env, *b->left, functions);
             if (left) return Value{true};
-            bool right = to_bool_like_cpp(eval_expr(env, *b->right, functions));
+            bool right = eval_condition(env, *b->right, functions);
             return Value{right};
         }
 
         Value lv = eval_expr(env, *b->left, functions);
         Value rv = eval_expr(env, *b->right, functions);
 
+        // Statisch geprüfte Operanden (sem): keine dynamischen Typprüfungen
+        const bool typed = b->left->typed && b->right->typed;
+
         switch (b->op) {
-            case BinaryExpr::Op::Add: return Value{ expect_int(lv, "+") + expect_int(rv, "+") };
-            case BinaryExpr::Op::Sub: return Value{ expect_int(lv, "-") - expect_int(rv, "-") };
-            case BinaryExpr::Op::Mul: return Value{ expect_int(lv, "*") * expect_int(rv, "*") };
+            case BinaryExpr::Op::Add:
+                if (typed) return Value{ unchecked<int>(lv) + unchecked<int>(rv) };
+                return Value{ expect_int(lv, "+") + expect_int(rv, "+") };
+            case BinaryExpr::Op::Sub:
+                if (typed) return Value{ unchecked<int>(lv) - unchecked<int>(rv) };
+                return Value{ expect_int(lv, "-") - expect_int(rv, "-") };
+            case BinaryExpr::Op::Mul:
+                if (typed) return Value{ unchecked<int>(lv) * unchecked<int>(rv) };
+                return Value{ expect_int(lv, "*") * expect_int(rv, "*") };
             case BinaryExpr::Op::Div: {
-                int r = expect_int(rv, "/");
+                int r = typed ? unchecked<int>(rv) : expect_int(rv, "/");
                 if (r == 0) throw std::runtime_error("runtime error: division by zero");
-                return Value{ expect_int(lv, "/") / r };
+                return Value{ (typed ? unchecked<int>(lv) : expect_int(lv, "/")) / r };
             }
             case BinaryExpr::Op::Mod: {
-                int r = expect_int(rv, "%");
+                int r = typed ? unchecked<int>(rv) : expect_int(rv, "%");
                 if (r == 0) throw std::runtime_error("runtime error: modulo by zero");
-                return Value{ expect_int(lv, "%") % r };
+                return Value{ (typed ? unchecked<int>(lv) : expect_int(lv, "%")) % r };
             }
             case BinaryExpr::Op::Lt: {
+                if (typed) return compare_typed(*b, lv, rv, [](auto l, auto r) { return l < r; });
                 if (auto* li = std::get_if<int>(&lv)) {
                     return Value{ *li < expect_int(rv, "<") };
                 }
@@ -450,6 +969,7 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
                 throw std::runtime_error("type error: invalid operands for <");
             }
             case BinaryExpr::Op::Le: {
+                if (typed) return compare_typed(*b, lv, rv, [](auto l, auto r) { return l <= r; });
                 if (auto* li = std::get_if<int>(&lv)) {
                     return Value{ *li <= expect_int(rv, "<=") };
                 }
@@ -461,6 +981,7 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
                 throw std::runtime_error("type error: invalid operands for <=");
             }
             case BinaryExpr::Op::Gt: {
+                if (typed) return compare_typed(*b, lv, rv, [](auto l, auto r) { return l > r; });
                 if (auto* li = std::get_if<int>(&lv)) {
                     return Value{ *li > expect_int(rv, ">") };
                 }
@@ -472,6 +993,7 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
                 throw std::runtime_error("type error: invalid operands for >");
             }
             case BinaryExpr::Op::Ge: {
+                if (typed) return compare_typed(*b, lv, rv, [](auto l, auto r) { return l >= r; });
                 if (auto* li = std::get_if<int>(&lv)) {
                     return Value{ *li >= expect_int(rv, ">=") };
                 }
@@ -483,6 +1005,7 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
                 throw std::runtime_error("type error: invalid operands for >=");
             }
             case BinaryExpr::Op::Eq: {
+                if (typed) return Value{ equal_typed(*b, lv, rv) };
                 if (lv.index() != rv.index()) throw std::runtime_error("type error: == requires same types");
                 if (auto* li = std::get_if<int>(&lv)) return Value{ *li == std::get<int>(rv) };
                 if (auto* lb = std::get_if<bool>(&lv)) return Value{ *lb == std::get<bool>(rv) };
@@ -491,6 +1014,7 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
                 throw std::runtime_error("type error: unsupported ==");
             }
             case BinaryExpr::Op::Ne: {
+                if (typed) return Value{ !equal_typed(*b, lv, rv) };
                 if (lv.index() != rv.index()) throw std::runtime_error("type error: != requires same types");
                 if (auto* li = std::get_if<int>(&lv)) return Value{ *li != std::get<int>(rv) };
                 if (auto* lb = std::get_if<bool>(&lv)) return Value{ *lb != std::get<bool>(rv) };
@@ -530,125 +1054,42 @@ inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions) {
 
     // Funktionsaufruf
     if (auto* c = dynamic_cast<const CallExpr*>(&e)) {
-        std::vector<Value> arg_vals;
-        std::vector<LValue> arg_lvals;
-        std::vector<ast::Type> arg_types;
-        std::vector<bool> arg_is_lv;
-
-        arg_vals.reserve(c->args.size());
-        arg_lvals.reserve(c->args.size());
-        arg_types.reserve(c->args.size());
-        arg_is_lv.reserve(c->args.size());
-
-        for (const auto& ap : c->args) {
-            bool islv = is_lvalue_expr(*ap);
-            arg_is_lv.push_back(islv);
-
-            Value v = eval_expr(env, *ap, functions);
-            arg_vals.push_back(v);
-            arg_types.push_back(type_of_value(v));
-
-            if (islv) arg_lvals.push_back(eval_lvalue(env, *ap, functions));
-            else arg_lvals.push_back(LValue{});
-        }
+        if (c->typed && is_builtin(c->callee)) return call_builtin_typed(env, *c, functions);
+
+        CallArgs args = eval_call_args(env, c->args, functions);
 
         // builtins
-        if (c->callee == "print_int" || c->callee == "print_bool" ||
-            c->callee == "print_char" || c->callee == "print_string") {
-            return call_builtin(c->callee, arg_vals);
+        if (is_builtin(c->callee)) {
+            return call_builtin(c->callee, args.vals);
         }
 
-        ast::FunctionDef& f = functions.resolve(c->callee, arg_types, arg_is_lv);
-        return call_function(env, f, arg_vals, arg_lvals, functions);
+        ast::FunctionDef& f = functions.resolve(c->callee, args.types, args.is_lv);
+        return call_function(env, f, args.vals, args.lvals, functions);
     }
 
     // Konstruktion: T(args)
     if (auto* ce = dynamic_cast<const ConstructExpr*>(&e)) {
-        std::vector<Value> arg_vals;
-        std::vector<LValue> arg_lvals;
-        std::vector<ast::Type> arg_types;
-        std::vector<bool> arg_is_lv;
-
-        for (const auto& ap : ce->args) {
-            bool islv = is_lvalue_expr(*ap);
-            arg_is_lv.push_back(islv);
+        CallArgs args = eval_call_args(env, ce->args, functions);
 
-            Value v = eval_expr(env, *ap, functions);
-            arg_vals.push_back(v);
-            arg_types.push_back(type_of_value(v));
+        const CtorPlan* plan = functions.class_rt.find_ctor_plan(ce->class_name, args.types, args.is_lv);
+        if (!plan)
+            throw std::runtime_error("runtime error: no matching constructor: " + ce->class_name);
 
-            if (islv) arg_lvals.push_back(eval_lvalue(env, *ap, functions));
-            else arg_lvals.push_back(LValue{});
-        }
+        // Impliziter Copy-Ctor: T(x) wobei x ein Objekt ist (auch D->B mit Slicing)
+        if (plan->kind == CtorPlan::Kind::Copy)
+            return copy_class_value_for_static_type(args.vals[0], ast::Type::Class(ce->class_name, false), functions);
 
         ObjectPtr obj = allocate_object_with_default_fields(ce->class_name, functions);
-
-        try {
-            const ast::ConstructorDef& ctor = functions.class_rt.resolve_ctor(ce->class_name, arg_types, arg_is_lv);
-            run_ctor_chain(env, obj, ce->class_name, ctor, arg_vals, arg_lvals, functions);
-        } catch (const std::runtime_error& ex) {
-            // Impliziter Copy-Ctor: T(x) wobei x ein Objekt ist (auch D->B mit Slicing)
-            if (ce->args.size() == 1) {
-                if (auto* src_obj = std::get_if<ObjectPtr>(&arg_vals[0])) {
-                    if (*src_obj) {
-                        Value copied = copy_class_value_for_static_type(arg_vals[0], ast::Type::Class(ce->class_name, false), functions);
-                        return copied;
-                    }
-                }
-            }
-            throw; // echter Konstruktor-Fehler
-        }
-
+        run_ctor_plan(env, obj, *plan, args.vals, args.lvals, functions);
         return Value{obj};
     }
 
     // Methodenaufruf: obj.m(args)
     if (auto* mc = dynamic_cast<const MethodCallExpr*>(&e)) {
-        // Objekt auswerten
-        Value objv = eval_expr(env, *mc->object, functions);
-        auto* pobj = std::get_if<ObjectPtr>(&objv);
-        if (!pobj || !*pobj)
-            throw std::runtime_error("method call on non-object");
-        ObjectPtr self = *pobj;
-
-        // Argumente
-        std::vector<Value> arg_vals;
-        std::vector<LValue> arg_lvals;
-        std::vector<ast::Type> arg_types;
-        std::vector<bool> arg_is_lv;
-
-        for (const auto& ap : mc->args) {
-            bool islv = is_lvalue_expr(*ap);
-            arg_is_lv.push_back(islv);
-
-            Value v = eval_expr(env, *ap, functions);
-            arg_vals.push_back(v);
-            arg_types.push_back(type_of_value(v));
-
-            if (islv) arg_lvals.push_back(eval_lvalue(env, *ap, functions));
-            else arg_lvals.push_back(LValue{});
-        }
-
-        // Statischer Typ + call_via_ref bestimmen (Polymorphie nur ueber Referenzen)
-        std::string static_class = self->dynamic_class;
-        bool call_via_ref = false;
-
-        if (auto* ve = dynamic_cast<const VarExpr*>(mc->object.get())) {
-            ast::Type st = env.static_type_of(ve->name);
-            if (st.base == ast::Type::Base::Class) static_class = st.class_name;
-            call_via_ref = env.is_ref_var(ve->name);
-        }
-
-        const ast::MethodDef& target = functions.class_rt.resolve_method(
-            static_class,
-            self->dynamic_class,
-            mc->method,
-            arg_types,
-            arg_is_lv,
-            call_via_ref
-        );
-
-        return call_method(env, self, static_class, target, arg_vals, arg_lvals, functions);
+        ObjectPtr self = eval_method_receiver(env, *mc, functions);
+        CallArgs args = eval_call_args(env, mc->args, functions);
+        CallTarget target = resolve_method_call(env, *mc, self, args, functions);
+        return invoke(env, std::move(target), &args.vals, &args.lvals, functions);
     }
 
     throw std::runtime_error("unknown expression");
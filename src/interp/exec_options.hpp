@@ -0,0 +1,26 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+namespace interp {
+
+// Ausführungsmodell fuer Skriptfunktionen (--engine)
+enum class Engine {
+    Tree,    // Baum-Interpreter (eval_expr/exec_stmt)
+    Closure  // Funktionen vorab in Closure-Bäume übersetzen (closure::Engine)
+};
+
+// Schalter fuer Ausführungsstrategien des Interpreters (per Kommandozeile gesetzt)
+struct ExecOptions {
+    bool tail_calls = true; // markierte "return f(...);" wiederverwenden den Frame (--no-tco schaltet ab)
+    bool jit = false;       // int/bool-Funktionen als Maschinencode ausführen (jit::Jit)
+    Engine engine = Engine::Tree; // übrige Funktionen: Baum-Interpreter oder Closure-Engine
+    bool statement_hooks = false; // Zeilen-/Heap-Profil oder Limits: exec_stmt ruft on_statement
+};
+
+// Prozessweite Optionen (konstant initialisiert => kein Guard beim Zugriff)
+inline ExecOptions& exec_options() {
+    static ExecOptions o;
+    return o;
+}
+
+} // namespace interp
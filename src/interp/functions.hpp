@@ -10,6 +10,8 @@
 #include "../ast/function.hpp"  // Funktionsdefinitionen
 #include "../ast/type.hpp"      // Typrepräsentation
 #include "class_runtime.hpp"    // Laufzeitinformationen fuer Klassen
+#include "trace.hpp"            // TracePhase (--trace)
+#include "stats.hpp"            // Zähler (--stats)
 
 namespace interp {
 
@@ -23,6 +25,14 @@ inline bool same_signature(const ast::FunctionDef& a, const ast::FunctionDef& b)
     return true;
 }
 
+// Prüft, ob ein Name eine eingebaute Funktion bezeichnet (auch für JIT und Closure-Engine)
+inline bool is_builtin(const std::string& name) {
+    return name == "print_int" || name == "print_bool" ||
+           name == "print_char" || name == "print_string" ||
+           name == "read_int" || name == "read_char" || name == "read_line" ||
+           name == "has_input" || name == "has_int";
+}
+
 // Hilfsfunktion: entfernt Referenzinformation aus einem Typ
 inline ast::Type base_type(ast::Type t) {
     t.is_ref = false;
@@ -41,6 +51,8 @@ struct FunctionTable {
     void clear() {
         functions.clear();
         class_rt.classes.clear();
+        class_rt.class_defs.clear();
+        class_rt.derived_classes.clear();
         class_rt.prog = nullptr;
     }
 
@@ -55,8 +67,14 @@ struct FunctionTable {
         vec.push_back(&f);
     }
 
+    // Registriert eine einzelne Klasse inkrementell (REPL)
+    void add_class(const ast::ClassDef& c) {
+        class_rt.add_class(c);
+    }
+
     // Initialisiert die FunctionTable aus einem kompletten Programm
     void add_program(ast::Program& p) {
+        TracePhase trace("FunctionTable::add_program");
         clear();
         for (auto& f : p.functions) add(f);
         class_rt.build(p);
@@ -70,6 +88,7 @@ struct FunctionTable {
     ast::FunctionDef& resolve(const std::string& name,
                               const std::vector<ast::Type>& arg_base_types,
                               const std::vector<bool>& arg_is_lvalue) {
+        ++stats().resolve_calls;
         auto it = functions.find(name);
         if (it == functions.end()) {
             throw std::runtime_error("unknown function: " + name);
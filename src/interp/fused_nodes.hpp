@@ -0,0 +1,91 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <string>      // std::string
+
+#include "binary_nodes.hpp"   // SpecialisedBinary, Operatoren
+#include "env.hpp"            // Env::storage_of
+#include "value.hpp"          // Laufzeitwerte
+#include "../ast/expr.hpp"    // ast::AssignExpr
+
+namespace interp {
+
+// Superinstruktionen (opt::fuse_superinstructions): häufige Muster über lokalen Variablen
+// als ein Knoten. Operanden werden direkt im Speicherplatz der Variable gelesen bzw.
+// geändert; es entstehen keine Value-Zwischenwerte pro Teilausdruck. Jeder Name wird pro
+// Auswertung genau einmal über die Scope-Kette gesucht (Env kennt keine Slot-Indizes, die
+// sich zur Übersetzungszeit festlegen ließen); ein Update x = x OP y sucht x also einmal
+// statt getrennt zum Lesen und zum Schreiben.
+
+// Liest eine Variable mit statisch bekanntem Typ T ohne Kopie (eine Suche in der Scope-Kette)
+template <class T>
+inline const T& local(Env& env, const std::string& name) {
+    return *std::get_if<T>(&env.storage_of(name));
+}
+
+// Name des i-ten Operanden (VarExpr, von der Fusion geprüft)
+inline const std::string& var_name(const ast::ExprPtr& e) {
+    return static_cast<const ast::VarExpr&>(*e).name;
+}
+
+// a OP b mit zwei Variablen: while (i < n), if (a == b), ...
+template <class Operation, class T>
+struct VarVarCmp : SpecialisedBinary {
+    Value eval(Env& env, FunctionTable&) const override {
+        const T& l = local<T>(env, var_name(left));
+        return Value{Operation::apply(l, local<T>(env, var_name(right)))};
+    }
+};
+
+// a OP c mit Variable und Literal: while (i < 10), if (c == 'x'), ...
+template <class Operation, class T>
+struct VarConstCmp : SpecialisedBinary {
+    T constant;
+    explicit VarConstCmp(T c) : constant(c) {}
+    Value eval(Env& env, FunctionTable&) const override {
+        return Value{Operation::apply(local<T>(env, var_name(left)), constant)};
+    }
+};
+
+// a OP b mit zwei int-Variablen: return a + b, ...
+template <class Operation>
+struct VarVarArith : SpecialisedBinary {
+    Value eval(Env& env, FunctionTable&) const override {
+        int l = local<int>(env, var_name(left));
+        return Value{Operation::apply(l, local<int>(env, var_name(right)))};
+    }
+};
+
+// Zuweisung, die als ein Knoten ausgewertet wird (Basis der Update-Superinstruktionen).
+// Bleibt ein AssignExpr (name + value), damit alle übrigen Durchläufe unverändert funktionieren.
+struct FusedAssign : ast::AssignExpr {
+    virtual Value eval(Env& env, FunctionTable& functions) const = 0;
+};
+
+// x = x OP y: eine Suche nach x, Änderung im Speicherplatz
+template <class Operation>
+struct VarUpdateVar : FusedAssign {
+    std::string operand; // y
+    explicit VarUpdateVar(std::string y) : operand(std::move(y)) {}
+    Value eval(Env& env, FunctionTable&) const override {
+        Value& target = env.storage_of(name);
+        int r = local<int>(env, operand);
+        int& x = *std::get_if<int>(&target);
+        x = Operation::apply(x, r);
+        return Value{x};
+    }
+};
+
+// x = x OP c: i = i + 1, n = n - 1, ...
+template <class Operation>
+struct VarUpdateConst : FusedAssign {
+    int constant;
+    explicit VarUpdateConst(int c) : constant(c) {}
+    Value eval(Env& env, FunctionTable&) const override {
+        int& x = *std::get_if<int>(&env.storage_of(name));
+        x = Operation::apply(x, constant);
+        return Value{x};
+    }
+};
+
+} // namespace interp
@@ -0,0 +1,207 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <algorithm>      // std::sort, std::min
+#include <csignal>        // std::signal, SIGUSR1, sig_atomic_t
+#include <cstdint>        // std::uint64_t
+#include <iomanip>        // std::setw
+#include <ostream>        // std::ostream
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+#include "limits.hpp"     // Limits (--max-heap-mb zählt dieselben Bytes)
+#include "located_error.hpp" // current_loc (Zeile der Allokationsstelle)
+
+namespace interp {
+
+// Heap-Markierung eines Objekts: von welcher Klasse/Stelle es angelegt wurde.
+// Wird beim Anlegen gesetzt und beim Zerstören an den Heap-Profiler und das
+// Heap-Limit zurückgemeldet (dynamic_class kann sich durch Slicing ändern, die Markierung nicht).
+struct HeapTag {
+    int site = -1;            // Index der Allokationsstelle (-1 => nicht erfasst)
+    std::uint32_t bytes = 0;  // geschätzte Größe bei der Allokation
+
+    HeapTag() = default;
+    HeapTag(const HeapTag&) {}                      // Kopien sind nicht erfasst
+    HeapTag& operator=(const HeapTag&) { return *this; }
+    inline ~HeapTag();
+};
+
+// Heap-Profiler fuer Skriptobjekte (--heap-profile).
+// Zählt pro dynamischer Klasse und pro Allokationsstelle (Funktion + Zeile)
+// lebende und insgesamt angelegte Objekte sowie geschätzte Bytes.
+// Ausgabe beim Beenden oder auf SIGUSR1 (an der nächsten sicheren Stelle).
+class HeapProfiler {
+public:
+    static constexpr size_t kTopSites = 20; // Allokationsstellen im Bericht
+
+    void enable() {
+        enabled_ = true;
+        std::signal(SIGUSR1, &HeapProfiler::on_signal);
+    }
+    bool enabled() const { return enabled_; }
+
+    // Neues Objekt: unit = gerade laufende Skript-Einheit (Schattenstack),
+    // Zeile = laufendes Statement (current_loc, von exec_stmt und den Aufrufen gepflegt)
+    void on_alloc(HeapTag& tag, const std::string& class_name, const void* unit, std::uint32_t bytes) {
+        const ast::SourceLoc* at = current_loc();
+        int cls = class_id(class_name);
+        int site = site_id(cls, unit, at ? at->line : 0);
+
+        tag.site = site;
+        tag.bytes = bytes;
+
+        Counters& c = classes_[static_cast<size_t>(cls)].counters;
+        Counters& s = sites_[static_cast<size_t>(site)].counters;
+        c.add(bytes);
+        s.add(bytes);
+    }
+
+    void on_free(const HeapTag& tag) {
+        Site& s = sites_[static_cast<size_t>(tag.site)];
+        s.counters.remove(tag.bytes);
+        classes_[static_cast<size_t>(s.cls)].counters.remove(tag.bytes);
+    }
+
+    // true, wenn per SIGUSR1 ein Bericht angefordert wurde (setzt die Anforderung zurück)
+    static bool take_dump_request() {
+        if (!dump_requested_) return false;
+        dump_requested_ = 0;
+        return true;
+    }
+
+    // Bericht; labels benennt die Skript-Einheiten (CallLabels)
+    void write_text(std::ostream& os, const std::unordered_map<const void*, std::string>& labels) const {
+        os << "=== Heap-Profil (Bytes geschätzt) ===\n";
+        os << std::left << std::setw(24) << "Klasse" << std::right
+           << std::setw(10) << "lebend" << std::setw(12) << "Peak" << std::setw(12) << "gesamt"
+           << std::setw(14) << "Bytes lebend" << std::setw(14) << "Bytes Peak"
+           << std::setw(16) << "Bytes gesamt" << "\n";
+
+        std::vector<const ClassEntry*> cls;
+        for (const auto& c : classes_) cls.push_back(&c);
+        std::sort(cls.begin(), cls.end(), [](const ClassEntry* a, const ClassEntry* b) {
+            return a->counters.total_bytes > b->counters.total_bytes;
+        });
+        for (const ClassEntry* c : cls) {
+            const Counters& k = c->counters;
+            os << std::left << std::setw(24) << c->name << std::right
+               << std::setw(10) << k.live << std::setw(12) << k.peak_live << std::setw(12) << k.total
+               << std::setw(14) << k.live_bytes << std::setw(14) << k.peak_bytes
+               << std::setw(16) << k.total_bytes << "\n";
+        }
+
+        std::vector<const Site*> sites;
+        for (const auto& s : sites_) sites.push_back(&s);
+        std::sort(sites.begin(), sites.end(), [](const Site* a, const Site* b) {
+            return a->counters.total_bytes > b->counters.total_bytes;
+        });
+        sites.resize(std::min(sites.size(), kTopSites));
+
+        os << "--- Allokationsstellen ---\n";
+        os << std::left << std::setw(40) << "Stelle" << std::setw(20) << "Klasse" << std::right
+           << std::setw(10) << "lebend" << std::setw(12) << "gesamt" << std::setw(16) << "Bytes gesamt"
+           << "\n";
+        for (const Site* s : sites) {
+            std::string where = "[top-level]";
+            if (s->unit) {
+                auto it = labels.find(s->unit);
+                where = it != labels.end() ? it->second : "<unbekannt>";
+            }
+            if (s->line > 0) where += ":" + std::to_string(s->line);
+
+            os << std::left << std::setw(40) << where
+               << std::setw(20) << classes_[static_cast<size_t>(s->cls)].name << std::right
+               << std::setw(10) << s->counters.live << std::setw(12) << s->counters.total
+               << std::setw(16) << s->counters.total_bytes << "\n";
+        }
+    }
+
+private:
+    struct Counters {
+        std::uint64_t live = 0, peak_live = 0, total = 0;
+        std::uint64_t live_bytes = 0, peak_bytes = 0, total_bytes = 0;
+
+        void add(std::uint64_t bytes) {
+            ++total;
+            total_bytes += bytes;
+            if (++live > peak_live) peak_live = live;
+            live_bytes += bytes;
+            if (live_bytes > peak_bytes) peak_bytes = live_bytes;
+        }
+        void remove(std::uint64_t bytes) {
+            --live;
+            live_bytes -= bytes;
+        }
+    };
+
+    struct ClassEntry {
+        std::string name;
+        Counters counters;
+    };
+
+    struct Site {
+        int cls;               // Klassenindex
+        const void* unit;      // Funktion/Methode/Konstruktor (nullptr => ausserhalb)
+        int line;              // Quelltextzeile
+        Counters counters;
+    };
+
+    // Schlüssel einer Allokationsstelle
+    struct SiteKey {
+        int cls;
+        const void* unit;
+        int line;
+        bool operator==(const SiteKey& o) const { return cls == o.cls && unit == o.unit && line == o.line; }
+    };
+    struct SiteKeyHash {
+        size_t operator()(const SiteKey& k) const {
+            size_t h = std::hash<const void*>()(k.unit);
+            h ^= (static_cast<size_t>(k.cls) << 32) ^ static_cast<size_t>(k.line) * 0x9e3779b97f4a7c15ULL;
+            return h;
+        }
+    };
+
+    bool enabled_ = false;
+    std::vector<ClassEntry> classes_;
+    std::unordered_map<std::string, int> class_ids_;
+    std::vector<Site> sites_;
+    std::unordered_map<SiteKey, int, SiteKeyHash> site_ids_;
+
+    static inline volatile std::sig_atomic_t dump_requested_ = 0;
+
+    static void on_signal(int) { dump_requested_ = 1; }
+
+    int class_id(const std::string& name) {
+        auto it = class_ids_.find(name);
+        if (it != class_ids_.end()) return it->second;
+        int id = static_cast<int>(classes_.size());
+        classes_.push_back(ClassEntry{name, {}});
+        class_ids_.emplace(name, id);
+        return id;
+    }
+
+    int site_id(int cls, const void* unit, int line) {
+        SiteKey key{cls, unit, line};
+        auto it = site_ids_.find(key);
+        if (it != site_ids_.end()) return it->second;
+        int id = static_cast<int>(sites_.size());
+        sites_.push_back(Site{cls, unit, line, {}});
+        site_ids_.emplace(key, id);
+        return id;
+    }
+};
+
+// Prozessweiter Heap-Profiler
+inline HeapProfiler& heap_profiler() {
+    static HeapProfiler p;
+    return p;
+}
+
+inline HeapTag::~HeapTag() {
+    if (site >= 0) heap_profiler().on_free(*this);
+    if (bytes && limits().tracks_heap()) limits().on_free(bytes);
+}
+
+} // namespace interp
@@ -0,0 +1,151 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstddef>     // std::size_t
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+#include "value.hpp"          // Laufzeitwerte, ObjectPtr
+#include "env.hpp"            // Env
+#include "../ast/expr.hpp"    // ast::CallExpr, ast::MethodCallExpr
+#include "../ast/class.hpp"   // ast::MethodDef
+#include "../ast/function.hpp" // ast::FunctionDef
+
+namespace interp {
+
+struct FunctionTable;
+
+// Vorwärtsdeklaration: Ausdrucksauswertung (exec.hpp)
+inline Value eval_expr(Env& env, const ast::Expr& e, FunctionTable& functions);
+
+// Inline-Aufrufe (opt::inline_calls): der Rumpf einer kleinen Funktion/Methode wird als
+// Kopie an der Aufrufstelle ausgewertet – ohne Argumentvektoren, Env, Feldbindung und
+// return-Statement. Der kopierte Rumpf enthält keine Aufrufe und kann nicht fehlschlagen;
+// Wertparameter und Empfänger liegen in einem InlineFrame auf dem C++-Stack.
+
+// Höchstzahl der Wertparameter eines Inline-Rumpfs
+constexpr std::size_t kMaxInlineParams = 4;
+
+// Argumente des gerade ausgewerteten Inline-Rumpfs
+struct InlineFrame {
+    ObjectPtr self;                   // Empfänger bei Methoden
+    Value args[kMaxInlineParams];     // Wertparameter (Referenzparameter sind ersetzt)
+};
+
+// Rahmen des laufenden Inline-Rumpfs (Rümpfe enthalten keine Aufrufe => keine Schachtelung)
+inline const InlineFrame*& current_inline_frame() {
+    static const InlineFrame* frame = nullptr;
+    return frame;
+}
+
+// Setzt den aktuellen Rahmen für die Dauer eines Rumpfs
+struct InlineFrameScope {
+    const InlineFrame* saved;
+    explicit InlineFrameScope(const InlineFrame& f) : saved(current_inline_frame()) {
+        current_inline_frame() = &f;
+    }
+    ~InlineFrameScope() { current_inline_frame() = saved; }
+
+    InlineFrameScope(const InlineFrameScope&) = delete;
+    InlineFrameScope& operator=(const InlineFrameScope&) = delete;
+};
+
+// Knoten, die nur in Inline-Rümpfen vorkommen (Parameter und Felder des Empfängers)
+struct InlineNode : ast::Expr {
+    virtual Value eval(Env& env, FunctionTable& functions) const = 0;
+};
+
+// Wertparameter i
+struct InlineParam : InlineNode {
+    std::size_t index;
+    explicit InlineParam(std::size_t i) : index(i) {}
+    Value eval(Env&, FunctionTable&) const override {
+        return current_inline_frame()->args[index];
+    }
+};
+
+// Feld des Empfängers im Speicher des Objekts
+inline Value& inline_field(const std::string& field) {
+    auto& fields = current_inline_frame()->self->fields;
+    auto it = fields.find(field);
+    if (it == fields.end())
+        throw std::runtime_error("unknown field at runtime: " + field);
+    return it->second;
+}
+
+// Feld des Empfängers lesen: return x;
+struct InlineFieldLoad : InlineNode {
+    std::string field;
+    explicit InlineFieldLoad(std::string f) : field(std::move(f)) {}
+    Value eval(Env&, FunctionTable&) const override {
+        return inline_field(field);
+    }
+};
+
+// Feld des Empfängers schreiben (primitive Typen): x = v;
+struct InlineFieldStore : InlineNode {
+    std::string field;
+    ast::ExprPtr value;
+    explicit InlineFieldStore(std::string f) : field(std::move(f)) {}
+    Value eval(Env& env, FunctionTable& functions) const override {
+        Value rhs = eval_expr(env, *value, functions);
+        inline_field(field) = rhs;
+        return rhs;
+    }
+};
+
+// Kopierter Rumpf: Ausdrucksstatements, optional gefolgt von return expr
+struct InlineBody {
+    std::vector<bool> by_value;          // pro Argument: Wertparameter (sonst Referenz, ersetzt)
+    std::vector<ast::ExprPtr> effects;   // Ausdrucksstatements
+    ast::ExprPtr result;                 // Rückgabewert (nullptr => void)
+
+    Value run(Env& env, FunctionTable& functions, const InlineFrame& frame) const {
+        InlineFrameScope scope(frame);
+        for (const auto& e : effects) eval_expr(env, *e, functions);
+        if (!result) return Value{0};
+        return eval_expr(env, *result, functions);
+    }
+
+    // Wertet die Wertargumente von links nach rechts in den Rahmen aus
+    void bind(Env& env, const std::vector<ast::ExprPtr>& args, FunctionTable& functions,
+              InlineFrame& frame) const {
+        std::size_t slot = 0;
+        for (std::size_t i = 0; i < args.size(); ++i)
+            if (by_value[i]) frame.args[slot++] = eval_expr(env, *args[i], functions);
+    }
+};
+
+// Aufruf einer freien Funktion mit kopiertem Rumpf.
+// Bleibt ein CallExpr, damit alle übrigen Durchläufe (JIT, Closure-Engine, C++-Emitter)
+// und der allgemeine Weg ohne statische Typen (REPL) unverändert funktionieren.
+struct InlinedCall : ast::CallExpr {
+    const ast::FunctionDef* target = nullptr;
+    InlineBody body;
+
+    Value eval(Env& env, FunctionTable& functions) const {
+        InlineFrame frame;
+        body.bind(env, args, functions, frame);
+        return body.run(env, functions, frame);
+    }
+};
+
+// Methodenaufruf obj.m(args) mit statisch bestimmter Zielmethode und kopiertem Rumpf
+struct InlinedMethodCall : ast::MethodCallExpr {
+    const ast::MethodDef* target = nullptr;
+    InlineBody body;
+
+    Value eval(Env& env, FunctionTable& functions) const {
+        InlineFrame frame;
+        Value objv = eval_expr(env, *object, functions);
+        auto* pobj = std::get_if<ObjectPtr>(&objv);
+        if (!pobj || !*pobj)
+            throw std::runtime_error("method call on non-object");
+        frame.self = std::move(*pobj);
+        body.bind(env, args, functions, frame);
+        return body.run(env, functions, frame);
+    }
+};
+
+} // namespace interp
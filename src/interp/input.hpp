@@ -0,0 +1,168 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cerrno>       // errno, EINTR
+#include <climits>      // INT_MIN, INT_MAX
+#include <cstring>      // std::strerror
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+
+#include <fcntl.h>      // open
+#include <unistd.h>     // read, close
+
+namespace interp {
+
+// Gepufferte Eingabe fuer die read_*-Builtins.
+// Liest blockweise per read() von stdin (oder einer Datei, --input <file>)
+// und parst Zahlen von Hand, d.h. ohne iostream/locale-Overhead.
+class InputSource {
+public:
+    static constexpr size_t kBufferSize = 1 << 16; // 64 KiB
+
+    InputSource() = default;
+    InputSource(const InputSource&) = delete;
+    InputSource& operator=(const InputSource&) = delete;
+
+    ~InputSource() {
+        if (owns_fd_) ::close(fd_);
+    }
+
+    // Liest ab jetzt aus einer Datei (--input <file>)
+    void open_file(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("konnte Eingabedatei nicht oeffnen: " + path +
+                                     " (" + std::strerror(errno) + ")");
+        if (owns_fd_) ::close(fd_);
+        fd_ = fd;
+        owns_fd_ = true;
+        pos_ = len_ = 0;
+        eof_ = false;
+    }
+
+    // true, solange noch mindestens ein Byte gelesen werden kann
+    bool has_input() {
+        return fill();
+    }
+
+    // true, wenn nach Whitespace eine Zahl folgt (read_int wuerde gelingen)
+    bool has_int() {
+        skip_whitespace();
+        if (!fill()) return false;
+        char c = buf_[pos_];
+        if (is_digit(c)) return true;
+        if (c != '-' && c != '+') return false;
+        // Vorzeichen allein reicht nicht: nächstes Zeichen prüfen
+        if (pos_ + 1 >= len_) {
+            // Vorzeichen steht am Pufferende: nach vorne schieben und nachladen
+            compact();
+            refill();
+        }
+        return pos_ + 1 < len_ && is_digit(buf_[pos_ + 1]);
+    }
+
+    // Liest eine Ganzzahl (führender Whitespace wird übersprungen)
+    int read_int() {
+        skip_whitespace();
+        if (!fill()) throw std::runtime_error("runtime error: read_int: end of input");
+
+        bool neg = false;
+        if (buf_[pos_] == '-' || buf_[pos_] == '+') {
+            neg = buf_[pos_] == '-';
+            ++pos_;
+        }
+
+        long long v = 0;
+        bool any = false;
+        while (fill() && is_digit(buf_[pos_])) {
+            v = v * 10 + (buf_[pos_] - '0');
+            if (v > static_cast<long long>(INT_MAX) + 1)
+                throw std::runtime_error("runtime error: read_int: integer out of range");
+            ++pos_;
+            any = true;
+        }
+        if (!any) throw std::runtime_error("runtime error: read_int: expected integer");
+
+        if (neg) v = -v;
+        if (v > INT_MAX) throw std::runtime_error("runtime error: read_int: integer out of range");
+        return static_cast<int>(v);
+    }
+
+    // Liest ein einzelnes Byte ('\0' am Eingabeende)
+    char read_char() {
+        if (!fill()) return '\0';
+        return buf_[pos_++];
+    }
+
+    // Liest bis zum Zeilenende (ohne '\n' bzw. "\r\n"; "" am Eingabeende)
+    std::string read_line() {
+        std::string line;
+        while (fill()) {
+            size_t start = pos_;
+            while (pos_ < len_ && buf_[pos_] != '\n') ++pos_;
+            line.append(buf_ + start, pos_ - start);
+            if (pos_ < len_) {
+                ++pos_; // '\n' konsumieren
+                break;
+            }
+        }
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        return line;
+    }
+
+private:
+    int fd_ = 0;             // Quell-Deskriptor (0 = stdin)
+    bool owns_fd_ = false;   // true => Deskriptor wurde selbst geoeffnet
+    bool eof_ = false;       // read() hat 0 geliefert
+    size_t pos_ = 0;         // Leseposition im Puffer
+    size_t len_ = 0;         // gueltige Bytes im Puffer
+    char buf_[kBufferSize];  // Eingabepuffer
+
+    static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    static bool is_space(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    // Stellt sicher, dass mindestens ein ungelesenes Byte im Puffer liegt
+    bool fill() {
+        if (pos_ < len_) return true;
+        pos_ = len_ = 0;
+        refill();
+        return pos_ < len_;
+    }
+
+    // Verschiebt den ungelesenen Rest an den Pufferanfang
+    void compact() {
+        size_t rest = len_ - pos_;
+        for (size_t i = 0; i < rest; ++i) buf_[i] = buf_[pos_ + i];
+        pos_ = 0;
+        len_ = rest;
+    }
+
+    // Liest weitere Bytes hinter len_ ein
+    void refill() {
+        while (!eof_ && len_ < kBufferSize) {
+            ssize_t n = ::read(fd_, buf_ + len_, kBufferSize - len_);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Eingabe fehlgeschlagen: ") + std::strerror(errno));
+            }
+            if (n == 0) eof_ = true;
+            len_ += static_cast<size_t>(n);
+            return;
+        }
+    }
+
+    void skip_whitespace() {
+        while (fill() && is_space(buf_[pos_])) ++pos_;
+    }
+};
+
+// Prozessweite Eingabe der Builtins
+inline InputSource& input() {
+    static InputSource source;
+    return source;
+}
+
+} // namespace interp
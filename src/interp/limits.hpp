@@ -0,0 +1,92 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstddef>    // size_t
+#include <cstdint>    // std::uint64_t
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+
+#include "clock.hpp"  // monotonic_ns
+
+namespace interp {
+
+// Ein Ausführungslimit wurde überschritten (eigener Exit-Code, siehe main)
+struct LimitExceeded : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+// Ausführungslimits fuer Batch-Läufe (--max-steps, --max-depth, --timeout-ms, --max-heap-mb).
+// Alle Prüfungen sind einfache Vergleiche; die Uhr wird nur alle kClockInterval Schritte gelesen.
+// 0 bedeutet jeweils "kein Limit".
+class Limits {
+public:
+    static constexpr std::uint64_t kClockInterval = 1024;
+
+    void set_max_steps(std::uint64_t n)      { max_steps_ = n; update(); }
+    void set_max_depth(size_t n)             { max_depth_ = n; update(); }
+    void set_timeout_ms(std::uint64_t ms)    { timeout_ns_ = ms * 1000000ULL; update(); }
+    void set_max_heap_bytes(std::uint64_t n) { max_heap_bytes_ = n; update(); }
+
+    // Irgendein Limit aktiv?
+    bool active() const { return active_; }
+
+    // Objektgrößen müssen mitgezählt werden?
+    bool tracks_heap() const { return max_heap_bytes_ != 0; }
+
+    // Startet Schritt- und Zeitbudget neu (Programmstart, jede REPL-Eingabe)
+    void restart() {
+        steps_ = 0;
+        deadline_ns_ = timeout_ns_ ? monotonic_ns() + timeout_ns_ : 0;
+    }
+
+    // Ein Statement wird ausgeführt
+    void on_step() {
+        ++steps_;
+        if (max_steps_ && steps_ > max_steps_)
+            throw LimitExceeded("limit exceeded: more than " + std::to_string(max_steps_) +
+                                " statements executed (--max-steps)");
+        if (deadline_ns_ && steps_ % kClockInterval == 0 && monotonic_ns() > deadline_ns_)
+            throw LimitExceeded("limit exceeded: running longer than " +
+                                std::to_string(timeout_ns_ / 1000000ULL) + " ms (--timeout-ms)");
+    }
+
+    // Ein Aufruf würde die Tiefe depth erreichen
+    void on_call(size_t depth) const {
+        if (max_depth_ && depth > max_depth_)
+            throw LimitExceeded("limit exceeded: call depth above " + std::to_string(max_depth_) +
+                                " (--max-depth)");
+    }
+
+    // Objekt mit geschätzten bytes angelegt / freigegeben
+    void on_alloc(std::uint64_t bytes) {
+        live_bytes_ += bytes;
+        if (live_bytes_ > max_heap_bytes_)
+            throw LimitExceeded("limit exceeded: live objects above " +
+                                std::to_string(max_heap_bytes_ / (1024 * 1024)) + " MiB (--max-heap-mb)");
+    }
+    void on_free(std::uint64_t bytes) { live_bytes_ -= bytes; }
+
+private:
+    bool active_ = false;
+    std::uint64_t max_steps_ = 0;
+    size_t max_depth_ = 0;
+    std::uint64_t timeout_ns_ = 0;
+    std::uint64_t max_heap_bytes_ = 0;
+
+    std::uint64_t steps_ = 0;       // ausgeführte Statements seit restart()
+    std::uint64_t deadline_ns_ = 0; // Abbruchzeitpunkt (0 => keiner)
+    std::uint64_t live_bytes_ = 0;  // geschätzte Bytes lebender Objekte
+
+    void update() {
+        active_ = max_steps_ || max_depth_ || timeout_ns_ || max_heap_bytes_;
+        restart();
+    }
+};
+
+// Prozessweite Limits
+inline Limits& limits() {
+    static Limits l;
+    return l;
+}
+
+} // namespace interp
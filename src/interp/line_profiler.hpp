@@ -0,0 +1,89 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <algorithm>   // std::sort, std::min
+#include <cstdint>     // uint64_t
+#include <iomanip>     // std::setw
+#include <ostream>     // std::ostream
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+namespace interp {
+
+// Zeilenprofil (--line-profile): zählt ausgeführte Statements pro Quelltextzeile.
+// Die Zähler liegen in einem nach Zeilennummer indizierten Vektor, d.h. ein Treffer
+// kostet nur einen Indexzugriff.
+class LineProfiler {
+public:
+    static constexpr size_t kDefaultTop = 20; // Anzahl Zeilen im Bericht
+
+    void enable() { enabled_ = true; }
+    bool enabled() const { return enabled_; }
+
+    // Quelltext des Skripts (fuer die Anzeige der Zeilen im Bericht)
+    void set_source(const std::string& src) {
+        lines_.clear();
+        size_t start = 0;
+        while (start <= src.size()) {
+            size_t end = src.find('\n', start);
+            if (end == std::string::npos) end = src.size();
+            lines_.push_back(src.substr(start, end - start));
+            start = end + 1;
+        }
+    }
+
+    // Ein Statement in Zeile line wurde ausgeführt
+    void hit(int line) {
+        if (line <= 0) return;
+        size_t l = static_cast<size_t>(line);
+        if (l >= counts_.size()) counts_.resize(l + 1, 0);
+        ++counts_[l];
+    }
+
+    // Bericht: die top meistausgeführten Zeilen, absteigend
+    void write_text(std::ostream& os, size_t top = kDefaultTop) const {
+        std::vector<size_t> hot;
+        uint64_t total = 0;
+        for (size_t l = 1; l < counts_.size(); ++l) {
+            if (counts_[l] == 0) continue;
+            hot.push_back(l);
+            total += counts_[l];
+        }
+        std::sort(hot.begin(), hot.end(), [this](size_t a, size_t b) {
+            if (counts_[a] != counts_[b]) return counts_[a] > counts_[b];
+            return a < b;
+        });
+        hot.resize(std::min(hot.size(), top));
+
+        os << "=== Zeilenprofil (" << total << " Statements) ===\n";
+        os << std::setw(7) << "Zeile" << std::setw(14) << "Anzahl" << std::setw(8) << "%"
+           << "  Quelltext\n";
+        for (size_t l : hot) {
+            double pct = total ? 100.0 * static_cast<double>(counts_[l]) / static_cast<double>(total) : 0.0;
+            os << std::setw(7) << l << std::setw(14) << counts_[l]
+               << std::setw(8) << std::fixed << std::setprecision(1) << pct
+               << "  " << source_line(l) << "\n";
+        }
+    }
+
+private:
+    bool enabled_ = false;
+    std::vector<uint64_t> counts_;    // Ausführungen pro Zeile (Index = Zeilennummer)
+    std::vector<std::string> lines_;  // Quelltextzeilen (Index 0 = Zeile 1)
+
+    // Quelltextzeile ohne führenden Whitespace (leer, falls unbekannt)
+    std::string source_line(size_t line) const {
+        if (line == 0 || line > lines_.size()) return "";
+        const std::string& s = lines_[line - 1];
+        size_t b = s.find_first_not_of(" \t");
+        return b == std::string::npos ? "" : s.substr(b);
+    }
+};
+
+// Prozessweites Zeilenprofil
+inline LineProfiler& line_profiler() {
+    static LineProfiler p;
+    return p;
+}
+
+} // namespace interp
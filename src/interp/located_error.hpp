@@ -0,0 +1,30 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string, std::to_string
+
+#include "../ast/location.hpp" // SourceLoc
+
+namespace interp {
+
+// Laufzeitfehler mit Quellposition "zeile:spalte: ..."
+// Wird am innersten Statement angebracht und danach unverändert weitergereicht.
+struct LocatedError : std::runtime_error {
+    ast::SourceLoc loc; // Position des fehlerhaften Statements
+
+    LocatedError(ast::SourceLoc at, const std::string& msg)
+        : std::runtime_error(std::to_string(at.line) + ":" + std::to_string(at.col) + ": " + msg),
+          loc(at) {}
+};
+
+// Position des zuletzt begonnenen Statements im Baum-Interpreter (nullptr => keines).
+// exec_stmt setzt sie, Aufrufe stellen bei normaler Rückkehr die des Aufrufers wieder her.
+// Ein Fehler verlässt den Aufruf daher mit der Position des innersten Statements und wird
+// erst dort (bzw. im REPL) einmal zu einem LocatedError.
+inline const ast::SourceLoc*& current_loc() {
+    static const ast::SourceLoc* loc = nullptr;
+    return loc;
+}
+
+} // namespace interp
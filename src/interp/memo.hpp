@@ -0,0 +1,129 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <algorithm>     // std::sort
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
+#include <functional>    // std::hash
+#include <iomanip>       // std::setw
+#include <ostream>       // std::ostream
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <unordered_set> // std::unordered_set
+#include <utility>       // std::pair
+#include <vector>        // std::vector
+
+#include "value.hpp"            // Laufzeitwerte
+#include "stats.hpp"            // Zähler (--stats)
+#include "../ast/function.hpp"  // ast::FunctionDef
+
+namespace interp {
+
+// --memoize: Ergebnisse reiner Funktionen (opt::PurityAnalysis) pro Funktion in einer
+// begrenzten Hash-Tabelle. Schlüssel sind die primitiven Argumentwerte; gespeichert werden
+// nur regulär beendete Aufrufe (Fehler laufen bei jedem Aufruf erneut auf).
+
+// Hash über primitive Argumentwerte (Objekte kommen in reinen Funktionen nicht vor)
+struct ArgsHash {
+    std::size_t operator()(const std::vector<Value>& args) const {
+        std::size_t h = args.size();
+        for (const Value& v : args) {
+            std::size_t x = v.index();
+            if (auto* i = std::get_if<int>(&v))              x ^= std::hash<int>()(*i) << 3;
+            else if (auto* b = std::get_if<bool>(&v))        x ^= std::hash<bool>()(*b) << 3;
+            else if (auto* c = std::get_if<char>(&v))        x ^= std::hash<char>()(*c) << 3;
+            else if (auto* s = std::get_if<std::string>(&v)) x ^= std::hash<std::string>()(*s) << 3;
+            h ^= x + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+};
+
+// Cache einer Funktion
+struct MemoTable {
+    // Höchstzahl der Einträge; ist die Tabelle voll, wird sie geleert
+    static constexpr std::size_t kCapacity = std::size_t(1) << 16;
+
+    std::unordered_map<std::vector<Value>, Value, ArgsHash> entries;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+
+    const Value* lookup(const std::vector<Value>& args) {
+        auto it = entries.find(args);
+        if (it == entries.end()) {
+            ++misses;
+            ++stats().memo_misses;
+            return nullptr;
+        }
+        ++hits;
+        ++stats().memo_hits;
+        return &it->second;
+    }
+
+    void store(const std::vector<Value>& args, const Value& result) {
+        if (entries.size() >= kCapacity) {
+            entries.clear();
+            ++evictions;
+        }
+        entries.emplace(args, result);
+    }
+};
+
+// Caches aller als rein erkannten Funktionen
+class Memo {
+public:
+    // recursive: f liegt auf einem Aufrufzyklus und bleibt beim Baum-Interpreter, damit auch
+    // die inneren Aufrufe den Cache treffen; sonst darf JIT-/Closure-Code hinter dem Cache laufen
+    void enable(const ast::FunctionDef& f, bool recursive) {
+        tables_[&f];
+        if (recursive) recursive_.insert(&f);
+    }
+
+    // Cache von f oder nullptr (nicht rein bzw. --memoize aus)
+    MemoTable* find(const ast::FunctionDef& f) {
+        if (tables_.empty()) return nullptr;
+        auto it = tables_.find(&f);
+        return it == tables_.end() ? nullptr : &it->second;
+    }
+
+    bool recursive(const ast::FunctionDef& f) const { return recursive_.count(&f) != 0; }
+
+    // Alle Caches verwerfen und --memoize beenden (neue Definitionen im REPL)
+    void reset() {
+        tables_.clear();
+        recursive_.clear();
+    }
+
+    // Treffer/Fehlschläge pro Funktion (--stats)
+    void write_text(std::ostream& os) const {
+        if (tables_.empty()) return;
+        std::vector<std::pair<const ast::FunctionDef*, const MemoTable*>> sorted;
+        for (const auto& [f, t] : tables_) sorted.emplace_back(f, &t);
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return a.first->loc.line < b.first->loc.line;
+        });
+        os << "=== Memoisierung ===\n";
+        for (const auto& [f, t] : sorted) {
+            std::string label = f->name + ":" + std::to_string(f->loc.line);
+            os << std::left << std::setw(26) << label << std::right
+               << " Hits " << std::setw(12) << t->hits
+               << "  Misses " << std::setw(12) << t->misses
+               << "  Einträge " << std::setw(8) << t->entries.size();
+            if (t->evictions) os << "  geleert " << t->evictions;
+            os << "\n";
+        }
+    }
+
+private:
+    std::unordered_map<const ast::FunctionDef*, MemoTable> tables_;
+    std::unordered_set<const ast::FunctionDef*> recursive_;
+};
+
+// Prozessweite Caches
+inline Memo& memo() {
+    static Memo m;
+    return m;
+}
+
+} // namespace interp
@@ -0,0 +1,133 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cerrno>       // errno
+#include <cstddef>      // size_t
+#include <cstdint>      // std::uintptr_t
+#include <cstring>      // std::strerror
+#include <exception>    // std::exception_ptr
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+
+#include <pthread.h>    // pthread_create, pthread_attr_setstack
+#include <signal.h>     // sigaltstack, sigaction
+#include <sys/mman.h>   // mmap, mprotect
+#include <unistd.h>     // write, _exit
+
+#include "output.hpp"   // gepufferte Programmausgabe (vor dem Abbruch schreiben)
+
+namespace interp {
+
+// Ausführung des Interpreters auf einem eigenen, großen Stack (--stack-mb).
+// Skript-Aufrufe laufen rekursiv über call_function -> exec_stmt -> eval_expr und
+// belegen pro Ebene einige KiB nativen Stack. Statt die Rekursion umzubauen, wird ein
+// großer Bereich reserviert (MAP_NORESERVE: nur berührte Seiten kosten Speicher) mit
+// Guard-Bereich am unteren Ende. Ein Überlauf trifft den Guard und wird per
+// SIGSEGV-Handler (auf einem Alternativ-Stack) als sauberer Fehler gemeldet.
+class NativeStack {
+public:
+    static constexpr size_t kGuardBytes = 1 << 20;       // 1 MiB Guard (auch große Frames)
+    static constexpr size_t kAltStackBytes = 64 * 1024;  // Stack fuer den Signal-Handler
+    static constexpr int kExitStackOverflow = 3;         // wie überschrittene Limits
+
+    // Führt fn() auf einem Stack mit bytes Nutzgröße aus und liefert dessen Ergebnis.
+    // Exceptions aus fn werden im aufrufenden Thread erneut geworfen.
+    template <class Fn>
+    static int run(size_t bytes, Fn fn) {
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        bytes = (bytes + page - 1) / page * page;
+        const size_t total = bytes + kGuardBytes;
+
+        void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+        if (base == MAP_FAILED)
+            throw std::runtime_error("konnte Interpreter-Stack nicht reservieren (" +
+                                     std::to_string(bytes >> 20) + " MiB): " + std::strerror(errno));
+        if (mprotect(base, kGuardBytes, PROT_NONE) != 0) {
+            munmap(base, total);
+            throw std::runtime_error(std::string("mprotect(Guard): ") + std::strerror(errno));
+        }
+
+        guard_lo() = reinterpret_cast<std::uintptr_t>(base);
+        guard_hi() = guard_lo() + kGuardBytes;
+
+        struct Job {
+            Fn* fn;
+            int result = 0;
+            std::exception_ptr error;
+        } job{&fn, 0, nullptr};
+
+        auto entry = [](void* p) -> void* {
+            Job* j = static_cast<Job*>(p);
+            install_overflow_handler();
+            try {
+                j->result = (*j->fn)();
+            } catch (...) {
+                j->error = std::current_exception();
+            }
+            return nullptr;
+        };
+
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        int rc = pthread_attr_setstack(&attr, static_cast<char*>(base) + kGuardBytes, bytes);
+        if (rc != 0) {
+            pthread_attr_destroy(&attr);
+            munmap(base, total);
+            guard_lo() = guard_hi() = 0;
+            throw std::runtime_error(std::string("pthread_attr_setstack: ") + std::strerror(rc));
+        }
+
+        pthread_t tid;
+        rc = pthread_create(&tid, &attr, entry, &job);
+        pthread_attr_destroy(&attr);
+        if (rc != 0) {
+            munmap(base, total);
+            guard_lo() = guard_hi() = 0;
+            throw std::runtime_error(std::string("pthread_create: ") + std::strerror(rc));
+        }
+        pthread_join(tid, nullptr);
+
+        munmap(base, total);
+        guard_lo() = guard_hi() = 0;
+
+        if (job.error) std::rethrow_exception(job.error);
+        return job.result;
+    }
+
+private:
+    static std::uintptr_t& guard_lo() { static std::uintptr_t v = 0; return v; }
+    static std::uintptr_t& guard_hi() { static std::uintptr_t v = 0; return v; }
+
+    // Alternativ-Stack + SIGSEGV-Handler fuer den Interpreter-Thread
+    static void install_overflow_handler() {
+        static thread_local char alt[kAltStackBytes];
+        stack_t ss {};
+        ss.ss_sp = alt;
+        ss.ss_size = sizeof(alt);
+        sigaltstack(&ss, nullptr);
+
+        struct sigaction sa {};
+        sa.sa_sigaction = &NativeStack::on_segv;
+        sigemptyset(&sa.sa_mask);
+        sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        sigaction(SIGSEGV, &sa, nullptr);
+    }
+
+    // Nur async-signal-sichere Aufrufe: Ausgabe und Meldung schreiben, dann beenden
+    static void on_segv(int sig, siginfo_t* info, void*) {
+        auto addr = reinterpret_cast<std::uintptr_t>(info->si_addr);
+        if (addr >= guard_lo() && addr < guard_hi()) {
+            output().flush_from_signal();
+            static const char msg[] =
+                "FEHLER: stack overflow: Rekursion zu tief (Interpreter-Stack mit --stack-mb vergrößern)\n";
+            ssize_t ignored = write(2, msg, sizeof(msg) - 1);
+            (void)ignored;
+            _exit(kExitStackOverflow);
+        }
+        // Anderer Speicherfehler: Standardverhalten (Core-Dump)
+        signal(sig, SIG_DFL);
+    }
+};
+
+} // namespace interp
@@ -5,3 +5,45 @@
 // Alle anderen Dateien sollen Object/ObjectPtr ausschließlich aus value.hpp beziehen,
 // damit es keine widersprüchlichen Typdefinitionen gibt.
 #include "value.hpp"
+
+#include <memory>       // std::make_shared
+#include <cstdint>      // std::uint32_t
+#include <string>       // std::string
+#include <utility>      // std::pair
+
+#include "profiler.hpp" // Allokationszählung (--profile)
+#include "heap_profiler.hpp" // Heap-Profil (--heap-profile)
+#include "call_stack.hpp"    // Schattenstack (Allokationsstelle)
+#include "limits.hpp"        // Heap-Limit (--max-heap-mb)
+
+namespace interp {
+
+// Geschätzte Größe eines Objekts mit field_count Feldern (ohne Inhalte langer Strings):
+// make_shared-Block + Hash-Knoten (Eintrag, next-Pointer, Hash) + Bucket-Array
+inline std::uint32_t approx_object_bytes(size_t field_count) {
+    constexpr size_t kControlBlock = 2 * sizeof(void*) + 2 * sizeof(int);
+    constexpr size_t kNode = sizeof(std::pair<const std::string, Value>) + 2 * sizeof(void*);
+    return static_cast<std::uint32_t>(kControlBlock + sizeof(Object) +
+                                      field_count * (kNode + sizeof(void*)));
+}
+
+// Zentraler Allokationspunkt fuer Laufzeitobjekte
+// field_count: Anzahl der Felder, die der Aufrufer gleich anlegt (fuer das Heap-Profil)
+inline ObjectPtr make_object(const std::string& dynamic_class, size_t field_count = 0) {
+    auto obj = std::make_shared<Object>();
+    obj->dynamic_class = dynamic_class;
+    ++stats().object_allocations;
+    if (profiler().enabled()) profiler().on_alloc();
+
+    HeapProfiler& hp = heap_profiler();
+    Limits& lim = limits();
+    if (hp.enabled() || lim.tracks_heap()) {
+        std::uint32_t bytes = approx_object_bytes(field_count);
+        if (hp.enabled()) hp.on_alloc(obj->heap, dynamic_class, shadow_stack().top(), bytes);
+        obj->heap.bytes = bytes;
+        if (lim.tracks_heap()) lim.on_alloc(bytes); // wirft ggf.; obj gibt die Bytes wieder frei
+    }
+    return obj;
+}
+
+} // namespace interp
@@ -0,0 +1,137 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cerrno>       // errno, EINTR
+#include <charconv>     // std::to_chars
+#include <cstring>      // std::memcpy, std::strerror
+#include <iostream>     // std::cout (Reihenfolge mit REPL-Ausgaben)
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+
+#include <fcntl.h>      // open
+#include <unistd.h>     // write, close
+
+namespace interp {
+
+// Gepufferte Ausgabe fuer die print_*-Builtins.
+// Schreibt direkt per write() auf einen Dateideskriptor (Default: stdout) und
+// formatiert Zahlen mit std::to_chars, d.h. ohne iostream und ohne Allokationen.
+// Geleert wird explizit: bei Programmende, vor Fehlermeldungen und vor dem REPL-Prompt.
+class OutputSink {
+public:
+    static constexpr size_t kBufferSize = 1 << 16; // 64 KiB
+
+    OutputSink() = default;
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    ~OutputSink() {
+        try {
+            flush();
+        } catch (...) {
+            // beim Beenden kann ein Schreibfehler nicht mehr gemeldet werden
+        }
+        if (owns_fd_) ::close(fd_);
+    }
+
+    // Leitet die Ausgabe in eine Datei um (--output <file>)
+    void open_file(const std::string& path) {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throw std::runtime_error("konnte Ausgabedatei nicht oeffnen: " + path +
+                                     " (" + std::strerror(errno) + ")");
+        flush();
+        if (owns_fd_) ::close(fd_);
+        fd_ = fd;
+        owns_fd_ = true;
+    }
+
+    // Ausgabe einer Zahl als eigene Zeile
+    void write_int_line(int v) {
+        reserve(16);
+        auto res = std::to_chars(buf_ + len_, buf_ + kBufferSize, v);
+        len_ = static_cast<size_t>(res.ptr - buf_);
+        buf_[len_++] = '\n';
+    }
+
+    // Ausgabe eines Zeichens als eigene Zeile
+    void write_char_line(char c) {
+        reserve(2);
+        buf_[len_++] = c;
+        buf_[len_++] = '\n';
+    }
+
+    // Ausgabe eines Strings als eigene Zeile
+    void write_string_line(const std::string& s) {
+        write_bytes(s.data(), s.size());
+        reserve(1);
+        buf_[len_++] = '\n';
+    }
+
+    // Schreibt den Puffer vollständig auf den Deskriptor
+    void flush() {
+        if (len_ == 0) return;
+        size_t n = len_;
+        len_ = 0;
+        write_all(buf_, n);
+    }
+
+    // Schreibt den Puffer aus einem Signal-Handler: nur write(2), keine Exceptions
+    void flush_from_signal() noexcept {
+        size_t off = 0;
+        while (off < len_) {
+            ssize_t w = ::write(fd_, buf_ + off, len_ - off);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) break;
+            off += static_cast<size_t>(w);
+        }
+        len_ = 0;
+    }
+
+private:
+    int fd_ = 1;            // Ziel-Deskriptor (1 = stdout)
+    bool owns_fd_ = false;  // true => Deskriptor wurde selbst geoeffnet
+    size_t len_ = 0;        // belegte Bytes im Puffer
+    char buf_[kBufferSize]; // Ausgabepuffer
+
+    // Stellt sicher, dass n Bytes in den Puffer passen
+    void reserve(size_t n) {
+        if (len_ + n > kBufferSize) flush();
+    }
+
+    // Schreibt Daten ungepuffert (inkl. Teil-Writes und EINTR)
+    void write_all(const char* data, size_t n) {
+        // Bereits ueber std::cout gepufferte Ausgaben (REPL) zuerst
+        if (fd_ == 1) std::cout.flush();
+
+        size_t off = 0;
+        while (off < n) {
+            ssize_t w = ::write(fd_, data + off, n - off);
+            if (w < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Ausgabe fehlgeschlagen: ") + std::strerror(errno));
+            }
+            off += static_cast<size_t>(w);
+        }
+    }
+
+    // Kopiert beliebig lange Daten in den Puffer (große Blöcke direkt)
+    void write_bytes(const char* data, size_t n) {
+        if (n > kBufferSize / 2) {
+            flush();
+            write_all(data, n);
+            return;
+        }
+        reserve(n);
+        std::memcpy(buf_ + len_, data, n);
+        len_ += n;
+    }
+};
+
+// Prozessweite Ausgabe der Builtins
+inline OutputSink& output() {
+    static OutputSink sink;
+    return sink;
+}
+
+} // namespace interp
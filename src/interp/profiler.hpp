@@ -0,0 +1,140 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <algorithm>      // std::sort
+#include <cstdint>        // std::uint64_t
+#include <iomanip>        // std::setw, std::setprecision
+#include <ostream>        // std::ostream
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+#include "clock.hpp"       // monotonic_ns
+#include "json.hpp"        // json_escape
+#include "call_labels.hpp" // CallLabels (Namen fuer Berichte)
+
+namespace interp {
+
+// Exakter Profiler auf Ebene von Funktionen, Methoden und Konstruktoren (--profile).
+// Zählt Aufrufe, inklusive/exklusive Zeit und Objekt-Allokationen pro Einheit.
+class Profiler {
+public:
+    struct Entry {
+        const void* key = nullptr;       // Identität der aufgerufenen Einheit
+        std::uint64_t calls = 0;         // Anzahl Aufrufe
+        std::uint64_t inclusive_ns = 0;  // Zeit inkl. aufgerufener Einheiten
+        std::uint64_t exclusive_ns = 0;  // Zeit ohne aufgerufene Einheiten
+        std::uint64_t allocations = 0;   // Objekt-Allokationen (exklusiv)
+        int active = 0;                  // Rekursionstiefe (inklusive Zeit nur äußerster Aufruf)
+    };
+
+    bool enabled() const { return enabled_; }
+    void enable() { enabled_ = true; }
+
+    // Betritt eine Einheit
+    void enter(const void* key) {
+        auto ins = index_.try_emplace(key, entries_.size());
+        if (ins.second) {
+            Entry e;
+            e.key = key;
+            entries_.push_back(e);
+        }
+        Entry& e = entries_[ins.first->second];
+        ++e.calls;
+        ++e.active;
+        stack_.push_back(Frame{ins.first->second, monotonic_ns(), 0});
+    }
+
+    // Verlässt die zuletzt betretene Einheit
+    void leave() {
+        Frame f = stack_.back();
+        stack_.pop_back();
+
+        std::uint64_t dur = monotonic_ns() - f.start_ns;
+        Entry& e = entries_[f.entry];
+        e.exclusive_ns += dur - f.child_ns;
+        if (--e.active == 0) e.inclusive_ns += dur;
+
+        if (!stack_.empty()) stack_.back().child_ns += dur;
+    }
+
+    // Objekt-Allokation: wird der gerade laufenden Einheit zugerechnet
+    void on_alloc() {
+        if (stack_.empty()) ++toplevel_allocations_;
+        else ++entries_[stack_.back().entry].allocations;
+    }
+
+    // Textbericht, sortiert nach exklusiver Zeit
+    void write_text(std::ostream& os, const CallLabels& labels) const {
+        std::vector<const Entry*> rows = sorted();
+
+        os << "--- Profil (--profile) ---\n";
+        os << std::setw(10) << "calls" << std::setw(12) << "incl ms"
+           << std::setw(12) << "excl ms" << std::setw(10) << "allocs" << "  name\n";
+
+        os << std::fixed << std::setprecision(3);
+        for (const Entry* e : rows) {
+            os << std::setw(10) << e->calls
+               << std::setw(12) << static_cast<double>(e->inclusive_ns) / 1e6
+               << std::setw(12) << static_cast<double>(e->exclusive_ns) / 1e6
+               << std::setw(10) << e->allocations
+               << "  " << label_of(labels, e->key) << "\n";
+        }
+        if (toplevel_allocations_)
+            os << "(" << toplevel_allocations_ << " Allokationen ausserhalb von Aufrufen)\n";
+        os.unsetf(std::ios::floatfield);
+    }
+
+    // JSON-Bericht (Zeiten in Mikrosekunden)
+    void write_json(std::ostream& os, const CallLabels& labels) const {
+        std::vector<const Entry*> rows = sorted();
+
+        os << "{\n  \"entries\": [";
+        for (size_t i = 0; i < rows.size(); ++i) {
+            const Entry* e = rows[i];
+            os << (i ? ",\n" : "\n")
+               << "    {\"name\": \"" << json_escape(label_of(labels, e->key)) << "\""
+               << ", \"calls\": " << e->calls
+               << ", \"inclusive_us\": " << e->inclusive_ns / 1000
+               << ", \"exclusive_us\": " << e->exclusive_ns / 1000
+               << ", \"allocations\": " << e->allocations << "}";
+        }
+        os << "\n  ],\n  \"toplevel_allocations\": " << toplevel_allocations_ << "\n}\n";
+    }
+
+private:
+    struct Frame {
+        size_t entry;            // Index in entries_
+        std::uint64_t start_ns;  // Startzeitpunkt
+        std::uint64_t child_ns;  // Zeit in aufgerufenen Einheiten
+    };
+
+    bool enabled_ = false;
+    std::unordered_map<const void*, size_t> index_;
+    std::vector<Entry> entries_;
+    std::vector<Frame> stack_;
+    std::uint64_t toplevel_allocations_ = 0;
+
+    static std::string label_of(const CallLabels& labels, const void* key) {
+        auto it = labels.find(key);
+        return it != labels.end() ? it->second : "<unbekannt>";
+    }
+
+    std::vector<const Entry*> sorted() const {
+        std::vector<const Entry*> rows;
+        rows.reserve(entries_.size());
+        for (const auto& e : entries_) rows.push_back(&e);
+        std::sort(rows.begin(), rows.end(), [](const Entry* a, const Entry* b) {
+            return a->exclusive_ns > b->exclusive_ns;
+        });
+        return rows;
+    }
+};
+
+// Prozessweiter Profiler
+inline Profiler& profiler() {
+    static Profiler p;
+    return p;
+}
+
+} // namespace interp
@@ -0,0 +1,146 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <atomic>         // std::atomic
+#include <cstring>        // std::strerror
+#include <cerrno>         // errno
+#include <map>            // std::map (sortierte Ausgabe)
+#include <ostream>        // std::ostream
+#include <stdexcept>      // std::runtime_error
+#include <string>         // std::string
+#include <vector>         // std::vector
+
+#include <signal.h>       // sigaction, SIGPROF
+#include <sys/time.h>     // setitimer
+
+#include "call_stack.hpp" // ShadowStack
+#include "call_labels.hpp"// CallLabels
+
+namespace interp {
+
+// Sampling-Profiler (--sample-profile=<hz>).
+// Ein SIGPROF-Timer unterbricht den Interpreter periodisch; der Handler kopiert den
+// Schattenstack in einen vorab reservierten Puffer. Ausgewertet wird erst beim Beenden
+// (Brendan-Gregg "folded stacks": "main();f(int);g() 42").
+class Sampler {
+public:
+    static constexpr size_t kMaxDepth = 128;       // pro Sample gespeicherte Frames (blattseitig)
+    static constexpr size_t kBufferFrames = 1 << 21; // Gesamtpuffer (16 MiB)
+
+    // Startet das Sampling mit hz Samples pro Sekunde CPU-Zeit
+    void start(int hz) {
+        if (hz <= 0 || hz > 100000)
+            throw std::runtime_error("--sample-profile: Frequenz muss zwischen 1 und 100000 liegen");
+
+        buffer_.assign(kBufferFrames, nullptr);
+        used_.store(0, std::memory_order_relaxed);
+        active_ = this;
+
+        struct sigaction sa {};
+        sa.sa_handler = &Sampler::on_signal;
+        sigemptyset(&sa.sa_mask);
+        sa.sa_flags = SA_RESTART;
+        if (sigaction(SIGPROF, &sa, nullptr) != 0)
+            throw std::runtime_error(std::string("sigaction(SIGPROF): ") + std::strerror(errno));
+
+        itimerval tv {};
+        long period = 1000000L / hz;                // µs; tv_usec muss < 1000000 bleiben
+        if (period == 0) period = 1;
+        tv.it_interval.tv_sec = period / 1000000;
+        tv.it_interval.tv_usec = period % 1000000;
+        tv.it_value = tv.it_interval;
+        if (setitimer(ITIMER_PROF, &tv, nullptr) != 0)
+            throw std::runtime_error(std::string("setitimer(ITIMER_PROF): ") + std::strerror(errno));
+
+        running_ = true;
+    }
+
+    // Stoppt den Timer (idempotent)
+    void stop() {
+        if (!running_) return;
+        itimerval tv {};
+        setitimer(ITIMER_PROF, &tv, nullptr);
+        signal(SIGPROF, SIG_IGN);
+        running_ = false;
+    }
+
+    bool running() const { return running_; }
+
+    // Schreibt die gesammelten Samples als folded stacks
+    void write_folded(std::ostream& os, const CallLabels& labels) const {
+        std::map<std::string, size_t> folded;
+
+        size_t used = used_.load(std::memory_order_acquire);
+        size_t i = 0;
+        while (i < used) {
+            // Layout pro Sample: [Anzahl Frames als Pointer-Wert] [Frames Wurzel -> Blatt]
+            size_t n = reinterpret_cast<size_t>(buffer_[i++]);
+            std::string key;
+            for (size_t k = 0; k < n && i < used; ++k, ++i) {
+                if (!key.empty()) key += ';';
+                const void* unit = buffer_[i];
+                if (unit == kTruncatedMarker()) key += "[abgeschnitten]";
+                else if (!unit) key += "[top-level]";
+                else {
+                    auto it = labels.find(unit);
+                    key += it != labels.end() ? it->second : "<unbekannt>";
+                }
+            }
+            if (key.empty()) key = "[top-level]";
+            ++folded[key];
+        }
+
+        for (const auto& kv : folded) os << kv.first << " " << kv.second << "\n";
+    }
+
+    size_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<const void*> buffer_;   // Samples (siehe Layout in write_folded)
+    std::atomic<size_t> used_{0};       // belegte Einträge in buffer_
+    std::atomic<size_t> dropped_{0};    // Samples, die nicht mehr in den Puffer passten
+    bool running_ = false;
+
+    static inline Sampler* active_ = nullptr;
+
+    // Platzhalter fuer abgeschnittene Wurzel-Frames
+    static const void* kTruncatedMarker() {
+        static const char marker = 0;
+        return &marker;
+    }
+
+    // Signal-Handler: nur atomare Lese-/Schreibzugriffe, keine Allokationen
+    static void on_signal(int) {
+        Sampler* self = active_;
+        if (!self) return;
+
+        const ShadowStack& ss = shadow_stack();
+        size_t depth = ss.depth.load(std::memory_order_relaxed);
+        std::atomic_signal_fence(std::memory_order_acquire);
+
+        size_t stored = depth < ShadowStack::kCapacity ? depth : ShadowStack::kCapacity;
+        size_t take = stored < kMaxDepth ? stored : kMaxDepth;
+        bool truncated = take < depth;
+
+        size_t need = 1 + take + (truncated ? 1 : 0);
+        size_t at = self->used_.load(std::memory_order_relaxed);
+        if (at + need > self->buffer_.size()) {
+            self->dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        self->buffer_[at++] = reinterpret_cast<const void*>(need - 1);
+        if (truncated) self->buffer_[at++] = kTruncatedMarker();
+        for (size_t k = stored - take; k < stored; ++k)
+            self->buffer_[at++] = ss.frames[k].load(std::memory_order_relaxed);
+        self->used_.store(at, std::memory_order_release);
+    }
+};
+
+// Prozessweiter Sampler
+inline Sampler& sampler() {
+    static Sampler s;
+    return s;
+}
+
+} // namespace interp
@@ -0,0 +1,90 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstdint>   // std::uint64_t
+#include <iomanip>   // std::setw
+#include <ostream>   // std::ostream
+
+namespace interp {
+
+// Zähler fuer interne Ereignisse des Interpreters (--stats).
+// Die Zähler laufen immer mit (einfache Inkremente auf einem statisch
+// initialisierten Objekt); --stats entscheidet nur über die Ausgabe.
+struct Stats {
+    std::uint64_t env_frames = 0;          // erzeugte Env-Frames (Aufrufe + Blöcke)
+    std::uint64_t slot_lookups = 0;        // Env::find_slot-Aufrufe
+    std::uint64_t slot_hops = 0;           // durchsuchte Scopes ohne Treffer
+    std::uint64_t object_allocations = 0;  // neu angelegte Objekte
+    std::uint64_t frame_objects = 0;       // Objekte nicht entkommender Locals im Env (ohne Heap)
+    std::uint64_t object_deep_copies = 0;  // tiefe Objektkopien (Wertsemantik)
+    std::uint64_t live_objects = 0;        // derzeit lebende Objekte
+    std::uint64_t peak_live_objects = 0;   // Maximum von live_objects
+    std::uint64_t resolve_calls = 0;       // FunctionTable::resolve
+    std::uint64_t resolve_method_calls = 0;// ClassRuntime::resolve_method
+    std::uint64_t devirtualised_calls = 0; // virtuelle Aufrufe über Referenz, laut CHA direkt
+    std::uint64_t returns = 0;             // ausgeführte return-Statements (Baum-Interpreter)
+    std::uint64_t string_copies = 0;       // kopierte String-Werte (Lesen von Variablen/Feldern)
+    std::uint64_t tail_calls = 0;          // Tail-Calls mit wiederverwendetem Frame
+    std::uint64_t jit_functions = 0;       // vom JIT übersetzte Funktionen
+    std::uint64_t jit_calls = 0;           // Einstiege aus dem Interpreter in JIT-Code
+    std::uint64_t closure_functions = 0;   // von der Closure-Engine übersetzte Funktionen
+    std::uint64_t specialised_ops = 0;     // durch typspezialisierte Knoten ersetzte Operatoren
+    std::uint64_t fused_sites = 0;         // zu Superinstruktionen fusionierte Stellen
+    std::uint64_t inlined_calls = 0;       // durch eine Kopie des Rumpfs ersetzte Aufrufstellen
+    std::uint64_t hoisted_exprs = 0;       // aus while-Schleifen herausgezogene Ausdrücke
+    std::uint64_t memo_hits = 0;           // Aufrufe reiner Funktionen aus dem Cache (--memoize)
+    std::uint64_t memo_misses = 0;         // ausgeführte Aufrufe gecachter Funktionen
+
+    void object_born() {
+        if (++live_objects > peak_live_objects) peak_live_objects = live_objects;
+    }
+    void object_died() { --live_objects; }
+
+    // Ausgabe als Tabelle (stderr)
+    void write_text(std::ostream& os) const {
+        os << "=== Interpreter-Statistik ===\n";
+        line(os, "Env-Frames", env_frames);
+        line(os, "Slot-Lookups", slot_lookups);
+        line(os, "Scope-Hops", slot_hops);
+        line(os, "Objekt-Allokationen", object_allocations);
+        line(os, "Frame-Objekte", frame_objects);
+        line(os, "Objekt-Tiefkopien", object_deep_copies);
+        line(os, "Objekte lebend (Peak)", peak_live_objects);
+        line(os, "resolve", resolve_calls);
+        line(os, "resolve_method", resolve_method_calls);
+        line(os, "Devirtualisierte Aufrufe", devirtualised_calls);
+        line(os, "return-Statements", returns);
+        line(os, "String-Kopien", string_copies);
+        line(os, "Tail-Calls", tail_calls);
+        line(os, "JIT-Funktionen", jit_functions);
+        line(os, "JIT-Einstiege", jit_calls);
+        line(os, "Closure-Funktionen", closure_functions);
+        line(os, "Spezialisierte Operatoren", specialised_ops);
+        line(os, "Superinstruktionen", fused_sites);
+        line(os, "Inline-Aufrufstellen", inlined_calls);
+        line(os, "Schleifeninvarianten", hoisted_exprs);
+        line(os, "Memo-Hits", memo_hits);
+        line(os, "Memo-Misses", memo_misses);
+    }
+
+    static void line(std::ostream& os, const char* label, std::uint64_t v) {
+        os << std::left << std::setw(26) << label << std::right << std::setw(16) << v << "\n";
+    }
+};
+
+// Prozessweite Zähler (konstant initialisiert => kein Guard beim Zugriff)
+inline Stats& stats() {
+    static Stats s;
+    return s;
+}
+
+// Zählt lebende Objekte; als Member von Object, damit dessen
+// implizite Kopier-/Move-Operationen erhalten bleiben
+struct LiveObjectCounter {
+    LiveObjectCounter() { stats().object_born(); }
+    LiveObjectCounter(const LiveObjectCounter&) { stats().object_born(); }
+    LiveObjectCounter& operator=(const LiveObjectCounter&) = default;
+    ~LiveObjectCounter() { stats().object_died(); }
+};
+
+} // namespace interp
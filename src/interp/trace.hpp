@@ -0,0 +1,114 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstdint>        // std::uint64_t
+#include <ostream>        // std::ostream
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+
+#include "clock.hpp"      // monotonic_ns
+#include "json.hpp"       // json_escape
+
+namespace interp {
+
+// Trace-Export im Chrome/Perfetto-Format (--trace <file.json>).
+// Aufgezeichnet werden Phasen (Parsen, Semantik, Aufbau der Runtime-Tabellen) und
+// Skript-Aufrufe ab einer Mindestdauer. Jedes Ereignis ist ein "X"-Event (Start + Dauer).
+class Tracer {
+public:
+    static constexpr size_t kMaxEvents = 1 << 20; // weitere Ereignisse werden nur gezählt
+
+    void enable(std::uint64_t threshold_us) {
+        enabled_ = true;
+        threshold_ns_ = threshold_us * 1000;
+        origin_ns_ = monotonic_ns();
+    }
+    bool enabled() const { return enabled_; }
+
+    // Phase des Interpreters (name muss ein String-Literal sein)
+    void phase(const char* name, std::uint64_t start_ns, std::uint64_t end_ns) {
+        record(Event{nullptr, name, start_ns, end_ns});
+    }
+
+    // Skript-Aufruf (Einheit wird erst beim Schreiben benannt); zu kurze Aufrufe entfallen
+    void call(const void* unit, std::uint64_t start_ns, std::uint64_t end_ns) {
+        if (end_ns - start_ns < threshold_ns_) return;
+        record(Event{unit, nullptr, start_ns, end_ns});
+    }
+
+    // Schreibt alle Ereignisse als JSON ({"traceEvents": [...]})
+    // labels: Namen der Skript-Einheiten (CallLabels)
+    void write_json(std::ostream& os, const std::unordered_map<const void*, std::string>& labels) const {
+        os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool first = true;
+        for (const auto& e : events_) {
+            std::string name;
+            if (e.phase) name = e.phase;
+            else {
+                auto it = labels.find(e.unit);
+                name = it != labels.end() ? it->second : "<unbekannt>";
+            }
+
+            if (!first) os << ",\n";
+            first = false;
+            os << "{\"name\":\"" << json_escape(name) << "\""
+               << ",\"cat\":\"" << (e.phase ? "interpreter" : "script") << "\""
+               << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+               << ",\"ts\":" << micros(e.start_ns - origin_ns_)
+               << ",\"dur\":" << micros(e.end_ns - e.start_ns) << "}";
+        }
+        os << "\n],\"otherData\":{\"dropped_events\":" << dropped_ << "}}\n";
+    }
+
+private:
+    struct Event {
+        const void* unit;       // Skript-Einheit (oder nullptr bei Phasen)
+        const char* phase;      // Phasenname (oder nullptr bei Aufrufen)
+        std::uint64_t start_ns;
+        std::uint64_t end_ns;
+    };
+
+    bool enabled_ = false;
+    std::uint64_t threshold_ns_ = 0;  // Mindestdauer fuer Aufrufe
+    std::uint64_t origin_ns_ = 0;     // Zeitnullpunkt des Traces
+    std::uint64_t dropped_ = 0;       // wegen kMaxEvents verworfene Ereignisse
+    std::vector<Event> events_;
+
+    void record(const Event& e) {
+        if (events_.size() >= kMaxEvents) { ++dropped_; return; }
+        events_.push_back(e);
+    }
+
+    // Nanosekunden -> Mikrosekunden mit drei Nachkommastellen (Trace-Format)
+    static std::string micros(std::uint64_t ns) {
+        std::string frac = std::to_string(ns % 1000);
+        return std::to_string(ns / 1000) + "." + std::string(3 - frac.size(), '0') + frac;
+    }
+};
+
+// Prozessweiter Tracer
+inline Tracer& tracer() {
+    static Tracer t;
+    return t;
+}
+
+// RAII fuer eine Interpreter-Phase (z.B. "parse"); ohne --trace wirkungslos
+class TracePhase {
+public:
+    explicit TracePhase(const char* name)
+        : name_(name), start_ns_(tracer().enabled() ? monotonic_ns() : 0) {}
+
+    ~TracePhase() {
+        if (tracer().enabled()) tracer().phase(name_, start_ns_, monotonic_ns());
+    }
+
+    TracePhase(const TracePhase&) = delete;
+    TracePhase& operator=(const TracePhase&) = delete;
+
+private:
+    const char* name_;
+    std::uint64_t start_ns_;
+};
+
+} // namespace interp
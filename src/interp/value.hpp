@@ -7,6 +7,8 @@
 #include <memory>           // std::shared_ptr
 
 #include "../ast/type.hpp"  // ast::Type (fuer Slicing)
+#include "stats.hpp"        // LiveObjectCounter (--stats)
+#include "heap_profiler.hpp" // HeapTag (--heap-profile)
 
 namespace interp {
 
@@ -22,6 +24,8 @@ using Value = std::variant<bool, int, char, std::string, ObjectPtr>;
 struct Object {
     std::string dynamic_class;                    // Dynamischer (runtime) Klassenname
     std::unordered_map<std::string, Value> fields; // Feldspeicher: Feldname -> Wert
+    LiveObjectCounter live;                        // Zählung lebender Objekte (--stats)
+    HeapTag heap;                                  // Allokationsstelle (--heap-profile)
 
     // Entfernt alle Felder, die nicht in allowed vorkommen (Object-Slicing)
     void slice_to(const std::string& static_class,
@@ -0,0 +1,781 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstddef>        // offsetof
+#include <cstdint>        // std::int64_t, std::uint8_t
+#include <cstring>        // std::memcpy
+#include <exception>      // std::exception
+#include <string>         // std::string
+#include <unordered_map>  // std::unordered_map
+#include <unordered_set>  // std::unordered_set
+#include <vector>         // std::vector
+
+#include <sys/mman.h>     // mmap, mprotect
+
+#include "x86_assembler.hpp"         // X86Assembler
+#include "../ast/function.hpp"       // ast::FunctionDef
+#include "../ast/expr.hpp"           // AST: Expression-Knoten
+#include "../ast/stmt.hpp"           // AST: Statement-Knoten
+#include "../interp/functions.hpp"   // FunctionTable::resolve, is_builtin
+#include "../interp/output.hpp"      // print_*-Builtins
+#include "../interp/input.hpp"       // read_*-Builtins
+#include "../interp/stats.hpp"       // Zähler (--stats)
+#include "../interp/exec_options.hpp" // Tail-Calls an/aus
+#include "../interp/memo.hpp"        // gecachte reine Funktionen (--memoize)
+
+namespace jit {
+
+// Laufzeitkontext eines JIT-Aufrufs (r15 zeigt darauf)
+struct JitContext {
+    std::uint64_t saved_rsp = 0; // rsp nach dem Sichern der Register (Fehlerausgang)
+    std::int64_t result = 0;     // Rückgabewert (eax der Funktion)
+    std::int32_t site = -1;      // Fehlerstelle (Index in Jit::sites) oder -1
+    std::int32_t unused = 0;
+    const char* error = nullptr; // Fehlermeldung einer Hilfsfunktion (nullptr = ok)
+};
+
+constexpr std::int8_t kCtxRsp = offsetof(JitContext, saved_rsp);
+constexpr std::int8_t kCtxResult = offsetof(JitContext, result);
+constexpr std::int8_t kCtxSite = offsetof(JitContext, site);
+constexpr std::int8_t kCtxError = offsetof(JitContext, error);
+
+// Position + Meldung eines Laufzeitfehlers im erzeugten Code
+struct ErrorSite {
+    ast::SourceLoc loc;          // innerstes Statement (wie LocatedError im Interpreter)
+    const char* message;         // nullptr => Meldung der Hilfsfunktion (JitContext::error)
+};
+
+// Einstieg in eine übersetzte Funktion: (Kontext, Argumente als int64) -> 0 ok / 1 Fehler
+using EntryFn = int (*)(JitContext*, const std::int64_t*);
+
+// Übersetzte Funktion (entry == nullptr => wird interpretiert)
+struct Compiled {
+    EntryFn entry = nullptr;
+    const std::uint8_t* body = nullptr; // Code mit interner Aufrufkonvention (fuer Aufrufe aus JIT-Code)
+};
+
+// ---------- Hilfsfunktionen fuer Builtins (aus JIT-Code aufgerufen) ----------
+
+inline std::string& helper_error_text() {
+    static std::string s;
+    return s;
+}
+
+// Exceptions dürfen nicht durch JIT-Frames laufen: Meldung im Kontext ablegen
+template <class F>
+inline std::int64_t guarded(JitContext* ctx, F f) {
+    try {
+        return f();
+    } catch (const std::exception& ex) {
+        helper_error_text() = ex.what();
+        ctx->error = helper_error_text().c_str();
+        return 0;
+    }
+}
+
+inline std::int64_t helper_print_int(JitContext* ctx, int v) {
+    return guarded(ctx, [&] { interp::output().write_int_line(v); return std::int64_t{0}; });
+}
+inline std::int64_t helper_print_bool(JitContext* ctx, int v) {
+    return guarded(ctx, [&] { interp::output().write_int_line(v ? 1 : 0); return std::int64_t{0}; });
+}
+inline std::int64_t helper_read_int(JitContext* ctx, int) {
+    return guarded(ctx, [&] { return std::int64_t{interp::input().read_int()}; });
+}
+inline std::int64_t helper_has_input(JitContext* ctx, int) {
+    return guarded(ctx, [&] { return std::int64_t{interp::input().has_input()}; });
+}
+inline std::int64_t helper_has_int(JitContext* ctx, int) {
+    return guarded(ctx, [&] { return std::int64_t{interp::input().has_int()}; });
+}
+
+// Funktion (oder Teil davon) nicht übersetzbar => Interpreter
+struct Unsupported {};
+
+// Übersetzer einer Funktion in x86-64-Code (Template-JIT).
+// Unterstützt: int/bool-Parameter und -Locals (keine Referenzen), Literale, Variablen,
+// Zuweisung, alle int/bool-Operatoren, if/while/return, Aufrufe freier Funktionen und
+// print_int/print_bool/read_int/has_input/has_int. Alles andere wirft Unsupported.
+//
+// Aufrufkonvention: Argumente von links nach rechts auf den Stack, Ergebnis in eax,
+// der Aufrufer räumt ab; Locals liegen in 8-Byte-Slots unter rbp.
+class FunctionCompiler {
+public:
+    // Aufrufstelle im Code: callee == nullptr => Sprung zum Fehlerausgang
+    struct Fixup {
+        size_t at;
+        const ast::FunctionDef* callee;
+    };
+
+    FunctionCompiler(const ast::FunctionDef& f, interp::FunctionTable& functions,
+                     std::vector<ErrorSite>& sites)
+        : f_(f), functions_(functions), sites_(sites) {}
+
+    std::vector<std::uint8_t> code;
+    std::vector<Fixup> fixups;
+
+    void compile() {
+        ret_ = type_of(f_.return_type, true);
+        cur_loc_ = f_.loc;
+
+        a_.push_rbp();
+        a_.mov_rbp_rsp();
+        a_.sub_rsp(0);
+        const size_t frame_at = a_.size() - 4;
+        a_.bind(body_start_);
+
+        // Parameter liegen über der Rücksprungadresse (letztes Argument zuoberst)
+        scopes_.emplace_back();
+        const int n = static_cast<int>(f_.params.size());
+        for (int i = 0; i < n; ++i) {
+            const auto& p = f_.params[i];
+            if (p.type.is_ref) throw Unsupported{};
+            declare(p.name, type_of(p.type, false), 16 + 8 * (n - 1 - i));
+        }
+
+        if (!f_.body) throw Unsupported{};
+        stmt(*f_.body);
+
+        // Ende ohne return: Default-Wert (0 / false)
+        a_.mov_eax_imm(0);
+        a_.bind(epilogue_);
+        a_.leave();
+        a_.ret();
+
+        std::int32_t frame = (locals_ * 8 + 15) & ~15;
+        std::memcpy(&a_.code()[frame_at], &frame, 4);
+        code = std::move(a_.code());
+    }
+
+private:
+    enum class Ty { Int, Bool, Void };
+
+    struct Var {
+        Ty type;
+        std::int32_t disp; // Offset relativ zu rbp
+    };
+
+    using Cond = X86Assembler::Cond;
+
+    const ast::FunctionDef& f_;
+    interp::FunctionTable& functions_;
+    std::vector<ErrorSite>& sites_;
+    X86Assembler a_;
+    X86Assembler::Label body_start_;
+    X86Assembler::Label epilogue_;
+    std::vector<std::unordered_map<std::string, Var>> scopes_;
+    int locals_ = 0;
+    Ty ret_ = Ty::Void;
+    ast::SourceLoc cur_loc_;
+
+    static Ty type_of(const ast::Type& t, bool allow_void) {
+        if (t.is_ref) throw Unsupported{};
+        switch (t.base) {
+            case ast::Type::Base::Int:  return Ty::Int;
+            case ast::Type::Base::Bool: return Ty::Bool;
+            case ast::Type::Base::Void: if (allow_void) return Ty::Void; break;
+            default: break;
+        }
+        throw Unsupported{};
+    }
+
+    static void require(bool ok) {
+        if (!ok) throw Unsupported{};
+    }
+
+    void declare(const std::string& name, Ty t, std::int32_t disp) {
+        require(scopes_.back().emplace(name, Var{t, disp}).second);
+    }
+
+    const Var& lookup(const std::string& name) const {
+        for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it) {
+            auto v = it->find(name);
+            if (v != it->end()) return v->second;
+        }
+        // Nicht lexikalisch sichtbar (z.B. Session-Variable im REPL) => Interpreter
+        throw Unsupported{};
+    }
+
+    // Bricht mit Laufzeitfehler ab, falls Bedingung c gilt
+    void fail_if(Cond c, const char* message) {
+        X86Assembler::Label ok;
+        a_.jcc(X86Assembler::negate(c), ok);
+        a_.mov_ctx_imm32(kCtxSite, static_cast<std::int32_t>(sites_.size()));
+        sites_.push_back(ErrorSite{cur_loc_, message});
+        fixups.push_back(Fixup{a_.jmp_rel32(), nullptr});
+        a_.bind(ok);
+    }
+
+    // Ruft eine Hilfsfunktion (ctx, eax) auf; Ergebnis in eax
+    void call_helper(const void* fn) {
+        a_.mov_rdi_r15();
+        a_.mov_esi_eax();
+        a_.call_helper(fn);
+        a_.cmp_ctx_zero64(kCtxError);
+        fail_if(Cond::NE, nullptr);
+    }
+
+    // ---------- Statements ----------
+
+    void stmt(const ast::Stmt& s) {
+        using namespace ast;
+        if (s.loc.known()) cur_loc_ = s.loc;
+
+        if (auto* b = dynamic_cast<const BlockStmt*>(&s)) {
+            scopes_.emplace_back();
+            for (const auto& st : b->statements) stmt(*st);
+            scopes_.pop_back();
+            return;
+        }
+
+        if (auto* v = dynamic_cast<const VarDeclStmt*>(&s)) {
+            Ty t = type_of(v->decl_type, false);
+            if (v->init) require(expr(*v->init) == t);
+            else a_.mov_eax_imm(0);
+            std::int32_t disp = -8 * ++locals_;
+            declare(v->name, t, disp);
+            a_.mov_local_eax(disp);
+            return;
+        }
+
+        if (auto* e = dynamic_cast<const ExprStmt*>(&s)) {
+            expr(*e->expr);
+            return;
+        }
+
+        if (auto* i = dynamic_cast<const IfStmt*>(&s)) {
+            X86Assembler::Label else_, end;
+            branch(*i->cond, false, else_);
+            sub_stmt(*i->then_branch);
+            if (i->else_branch) {
+                a_.jmp(end);
+                a_.bind(else_);
+                sub_stmt(*i->else_branch);
+                a_.bind(end);
+            } else {
+                a_.bind(else_);
+            }
+            return;
+        }
+
+        if (auto* w = dynamic_cast<const WhileStmt*>(&s)) {
+            X86Assembler::Label top, exit;
+            a_.bind(top);
+            branch(*w->cond, false, exit);
+            sub_stmt(*w->body);
+            a_.jmp(top);
+            a_.bind(exit);
+            return;
+        }
+
+        if (auto* r = dynamic_cast<const ReturnStmt*>(&s)) {
+            if (!r->value) {
+                require(ret_ == Ty::Void);
+                a_.jmp(epilogue_);
+                return;
+            }
+            require(ret_ != Ty::Void);
+            Ty t;
+            auto* c = dynamic_cast<const CallExpr*>(r->value.get());
+            if (c && r->tail_call && interp::exec_options().tail_calls && !interp::is_builtin(c->callee)) {
+                bool jumped = false;
+                t = call_function(*c, &jumped);
+                if (jumped) return;
+            } else {
+                t = expr(*r->value);
+            }
+            require(t == ret_);
+            a_.jmp(epilogue_);
+            return;
+        }
+
+        throw Unsupported{};
+    }
+
+    // Rumpf von if/while: eine Deklaration ohne Block landete im umgebenden Scope
+    void sub_stmt(const ast::Stmt& s) {
+        require(dynamic_cast<const ast::VarDeclStmt*>(&s) == nullptr);
+        stmt(s);
+    }
+
+    // ---------- Ausdrücke ----------
+
+    static ast::Type arg_type(Ty t) {
+        if (t == Ty::Int) return ast::Type::Int();
+        if (t == Ty::Bool) return ast::Type::Bool();
+        throw Unsupported{};
+    }
+
+    const ast::FunctionDef* resolve(const std::string& name, const std::vector<ast::Type>& types,
+                                    const std::vector<bool>& lvalues) {
+        try {
+            return &functions_.resolve(name, types, lvalues);
+        } catch (const std::runtime_error&) {
+            throw Unsupported{}; // Fehler meldet der Interpreter
+        }
+    }
+
+    // Einfacher rechter Operand: direkt nach ecx laden (eax bleibt erhalten)
+    bool load_ecx_simple(const ast::Expr& e, Ty& t) {
+        if (auto* i = dynamic_cast<const ast::IntLiteral*>(&e)) {
+            a_.mov_ecx_imm(i->value);
+            t = Ty::Int;
+            return true;
+        }
+        if (auto* v = dynamic_cast<const ast::VarExpr*>(&e)) {
+            const Var& var = lookup(v->name);
+            a_.mov_ecx_local(var.disp);
+            t = var.type;
+            return true;
+        }
+        return false;
+    }
+
+    // Linker Operand nach eax, rechter nach ecx
+    void operands(const ast::BinaryExpr& b, Ty& lt, Ty& rt) {
+        lt = expr(*b.left);
+        if (load_ecx_simple(*b.right, rt)) return;
+        a_.push_rax();
+        rt = expr(*b.right);
+        a_.mov_ecx_eax();
+        a_.pop_rax();
+    }
+
+    static bool comparison(ast::BinaryExpr::Op op, Cond& c) {
+        using Op = ast::BinaryExpr::Op;
+        switch (op) {
+            case Op::Lt: c = Cond::L; return true;
+            case Op::Le: c = Cond::LE; return true;
+            case Op::Gt: c = Cond::G; return true;
+            case Op::Ge: c = Cond::GE; return true;
+            case Op::Eq: c = Cond::E; return true;
+            case Op::Ne: c = Cond::NE; return true;
+            default: return false;
+        }
+    }
+
+    // Vergleich: Flags setzen, Bedingung liefern
+    Cond compare(const ast::BinaryExpr& b, Cond c) {
+        Ty lt, rt;
+        operands(b, lt, rt);
+        require(lt == rt && lt != Ty::Void);
+        // <, <=, >, >= nur fuer int (== / != auch fuer bool)
+        require(lt == Ty::Int || c == Cond::E || c == Cond::NE);
+        a_.cmp_eax_ecx();
+        return c;
+    }
+
+    // Springt nach target, wenn der Wahrheitswert von e gleich jump_if ist
+    void branch(const ast::Expr& e, bool jump_if, X86Assembler::Label& target) {
+        using namespace ast;
+
+        if (auto* bl = dynamic_cast<const BoolLiteral*>(&e)) {
+            if (bl->value == jump_if) a_.jmp(target);
+            return;
+        }
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e); u && u->op == UnaryExpr::Op::Not) {
+            branch_bool(*u->expr, !jump_if, target);
+            return;
+        }
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
+            Cond c;
+            if (comparison(b->op, c)) {
+                c = compare(*b, c);
+                a_.jcc(jump_if ? c : X86Assembler::negate(c), target);
+                return;
+            }
+            if (b->op == BinaryExpr::Op::AndAnd) {
+                if (jump_if) {
+                    X86Assembler::Label skip;
+                    branch(*b->left, false, skip);
+                    branch(*b->right, true, target);
+                    a_.bind(skip);
+                } else {
+                    branch(*b->left, false, target);
+                    branch(*b->right, false, target);
+                }
+                return;
+            }
+            if (b->op == BinaryExpr::Op::OrOr) {
+                if (jump_if) {
+                    branch(*b->left, true, target);
+                    branch(*b->right, true, target);
+                } else {
+                    X86Assembler::Label skip;
+                    branch(*b->left, true, skip);
+                    branch(*b->right, false, target);
+                    a_.bind(skip);
+                }
+                return;
+            }
+        }
+
+        // Allgemein: Wert berechnen, int/bool wie to_bool_like_cpp
+        Ty t = expr(e);
+        require(t != Ty::Void);
+        a_.test_eax_eax();
+        a_.jcc(jump_if ? Cond::NE : Cond::E, target);
+    }
+
+    // Wie branch, verlangt aber einen bool-Operanden (Operand von "!")
+    void branch_bool(const ast::Expr& e, bool jump_if, X86Assembler::Label& target) {
+        require(expr(e) == Ty::Bool);
+        a_.test_eax_eax();
+        a_.jcc(jump_if ? Cond::NE : Cond::E, target);
+    }
+
+    // Wertet e nach eax aus und liefert den Typ
+    Ty expr(const ast::Expr& e) {
+        using namespace ast;
+
+        if (auto* i = dynamic_cast<const IntLiteral*>(&e)) {
+            a_.mov_eax_imm(i->value);
+            return Ty::Int;
+        }
+        if (auto* bl = dynamic_cast<const BoolLiteral*>(&e)) {
+            a_.mov_eax_imm(bl->value ? 1 : 0);
+            return Ty::Bool;
+        }
+        if (auto* v = dynamic_cast<const VarExpr*>(&e)) {
+            const Var& var = lookup(v->name);
+            a_.mov_eax_local(var.disp);
+            return var.type;
+        }
+        if (auto* as = dynamic_cast<const AssignExpr*>(&e)) {
+            Ty t = expr(*as->value);
+            const Var& var = lookup(as->name);
+            require(t == var.type);
+            a_.mov_local_eax(var.disp);
+            return t;
+        }
+
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) {
+            Ty t = expr(*u->expr);
+            if (u->op == UnaryExpr::Op::Neg) {
+                require(t == Ty::Int);
+                a_.neg_eax();
+                return Ty::Int;
+            }
+            require(t == Ty::Bool);
+            a_.xor_eax_1();
+            return Ty::Bool;
+        }
+
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
+            Cond c;
+            if (comparison(b->op, c)) {
+                a_.setcc_eax(compare(*b, c));
+                return Ty::Bool;
+            }
+            if (b->op == BinaryExpr::Op::AndAnd || b->op == BinaryExpr::Op::OrOr) {
+                X86Assembler::Label f, end;
+                branch(e, false, f);
+                a_.mov_eax_imm(1);
+                a_.jmp(end);
+                a_.bind(f);
+                a_.mov_eax_imm(0);
+                a_.bind(end);
+                return Ty::Bool;
+            }
+
+            Ty lt, rt;
+            operands(*b, lt, rt);
+            require(lt == Ty::Int && rt == Ty::Int);
+            switch (b->op) {
+                case BinaryExpr::Op::Add: a_.add_eax_ecx(); break;
+                case BinaryExpr::Op::Sub: a_.sub_eax_ecx(); break;
+                case BinaryExpr::Op::Mul: a_.imul_eax_ecx(); break;
+                case BinaryExpr::Op::Div:
+                case BinaryExpr::Op::Mod:
+                    a_.test_ecx_ecx();
+                    fail_if(Cond::E, b->op == BinaryExpr::Op::Div ? "runtime error: division by zero"
+                                                                  : "runtime error: modulo by zero");
+                    a_.cdq();
+                    a_.idiv_ecx();
+                    if (b->op == BinaryExpr::Op::Mod) a_.mov_eax_edx();
+                    break;
+                default: throw Unsupported{};
+            }
+            return Ty::Int;
+        }
+
+        if (auto* c = dynamic_cast<const CallExpr*>(&e)) return call(*c);
+
+        throw Unsupported{};
+    }
+
+    Ty call(const ast::CallExpr& c) {
+        const std::string& n = c.callee;
+
+        // Builtins (haben wie im Interpreter Vorrang vor Skriptfunktionen)
+        if (interp::is_builtin(n)) {
+            if (n == "print_int" || n == "print_bool") {
+                require(c.args.size() == 1);
+                require(expr(*c.args[0]) == (n == "print_int" ? Ty::Int : Ty::Bool));
+                call_helper(reinterpret_cast<const void*>(n == "print_int" ? &helper_print_int : &helper_print_bool));
+                return Ty::Void;
+            }
+            require(c.args.empty());
+            if (n == "read_int") {
+                call_helper(reinterpret_cast<const void*>(&helper_read_int));
+                return Ty::Int;
+            }
+            if (n == "has_input" || n == "has_int") {
+                call_helper(reinterpret_cast<const void*>(n == "has_input" ? &helper_has_input : &helper_has_int));
+                return Ty::Bool;
+            }
+            throw Unsupported{}; // read_char, read_line, print_char, print_string
+        }
+
+        return call_function(c, nullptr);
+    }
+
+    // Aufruf einer Skriptfunktion. Mit tail_jump != nullptr wird ein Selbstaufruf
+    // ("return f(...);" in f) zum Sprung an den Anfang: Parameter überschreiben, Frame bleibt.
+    Ty call_function(const ast::CallExpr& c, bool* tail_jump) {
+        std::vector<ast::Type> types;
+        std::vector<bool> lvalues;
+        for (const auto& arg : c.args) {
+            types.push_back(arg_type(expr(*arg)));
+            lvalues.push_back(dynamic_cast<const ast::VarExpr*>(arg.get()) != nullptr);
+            a_.push_rax();
+        }
+
+        const ast::FunctionDef* callee = resolve(c.callee, types, lvalues);
+        Ty ret = type_of(callee->return_type, true);
+
+        if (tail_jump && callee == &f_) {
+            const int n = static_cast<int>(f_.params.size());
+            for (int i = n - 1; i >= 0; --i) {
+                a_.pop_rax();
+                a_.mov_local_eax(16 + 8 * (n - 1 - i));
+            }
+            a_.jmp(body_start_);
+            *tail_jump = true;
+            return ret;
+        }
+
+        fixups.push_back(Fixup{a_.call_rel32(), callee});
+        if (!c.args.empty()) a_.add_rsp(static_cast<std::int32_t>(8 * c.args.size()));
+        return ret;
+    }
+};
+
+// Ausführbarer Speicher fuer JIT-Code: ein reservierter Bereich, in den angehängt wird.
+// Schreiben und Ausführen sind nie gleichzeitig erlaubt (W^X per mprotect).
+class CodeRegion {
+public:
+    static constexpr size_t kSize = size_t(64) << 20; // 64 MiB => rel32 reicht überall hin
+
+    ~CodeRegion() {
+        if (base_) ::munmap(base_, kSize);
+    }
+
+    std::uint8_t* base() const { return base_; }
+    size_t used() const { return used_; }
+
+    // Hängt Code an; nullptr, wenn kein Platz (mehr) ist
+    std::uint8_t* append(const std::vector<std::uint8_t>& code) {
+        if (!base_) {
+            void* p = ::mmap(nullptr, kSize, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (p == MAP_FAILED) return nullptr;
+            base_ = static_cast<std::uint8_t*>(p);
+        }
+        if (code.size() > kSize - used_) return nullptr;
+
+        if (::mprotect(base_, kSize, PROT_READ | PROT_WRITE) != 0) return nullptr;
+        std::uint8_t* at = base_ + used_;
+        std::memcpy(at, code.data(), code.size());
+        used_ += (code.size() + 15) & ~size_t(15);
+        if (used_ > kSize) used_ = kSize;
+        if (::mprotect(base_, kSize, PROT_READ | PROT_EXEC) != 0) return nullptr;
+        return at;
+    }
+
+    // Verwirft allen Code (nur, wenn keine JIT-Frames aktiv sind)
+    void clear() { used_ = 0; }
+
+private:
+    std::uint8_t* base_ = nullptr;
+    size_t used_ = 0;
+};
+
+// Baseline-JIT fuer int/bool-Funktionen.
+// Übersetzt beim ersten Aufruf eine Funktion samt aller erreichbaren Aufrufziele;
+// Funktionen, die (transitiv) etwas nicht Unterstütztes brauchen, bleiben beim Interpreter.
+class Jit {
+public:
+    // Übersetzter Code fuer f oder nullptr (=> interpretieren)
+    const Compiled* find(const ast::FunctionDef& f, interp::FunctionTable& functions) {
+        auto it = compiled_.find(&f);
+        if (it == compiled_.end()) {
+            compile_group(f, functions);
+            it = compiled_.find(&f);
+        }
+        return it->second.entry ? &it->second : nullptr;
+    }
+
+    const ErrorSite& site(std::int32_t i) const { return sites_.at(static_cast<size_t>(i)); }
+
+    // Neue Definitionen (REPL) können die Overload-Auflösung ändern: alles neu übersetzen
+    void reset() {
+        compiled_.clear();
+        sites_.clear();
+        region_.clear();
+        error_exit_ = nullptr;
+    }
+
+private:
+    std::unordered_map<const ast::FunctionDef*, Compiled> compiled_;
+    std::vector<ErrorSite> sites_;
+    CodeRegion region_;
+    const std::uint8_t* error_exit_ = nullptr;
+
+    // Fehlerausgang: Stack des Einstiegs wiederherstellen und 1 liefern
+    bool ensure_error_exit() {
+        if (error_exit_) return true;
+        X86Assembler a;
+        a.mov_rsp_ctx(kCtxRsp);
+        a.mov_eax_imm(1);
+        a.pop_callee_saved();
+        a.ret();
+        error_exit_ = region_.append(a.code());
+        return error_exit_ != nullptr;
+    }
+
+    // Einstieg: Register sichern, Argumente pushen, Funktion aufrufen
+    // body_offset: Position des Rumpfs relativ zum Anfang des Einstiegs
+    static std::vector<std::uint8_t> entry_code(size_t nargs, std::int64_t body_offset) {
+        X86Assembler a;
+        a.push_callee_saved();
+        a.mov_r15_rdi();
+        a.mov_ctx_rsp(kCtxRsp);
+        for (size_t i = 0; i < nargs; ++i) a.push_rsi_mem(static_cast<std::int32_t>(8 * i));
+        size_t at = a.call_rel32();
+        std::int32_t rel = static_cast<std::int32_t>(body_offset - static_cast<std::int64_t>(at + 4));
+        std::memcpy(&a.code()[at], &rel, 4);
+        if (nargs) a.add_rsp(static_cast<std::int32_t>(8 * nargs));
+        a.mov_ctx_rax(kCtxResult);
+        a.mov_eax_imm(0);
+        a.pop_callee_saved();
+        a.ret();
+        return a.code();
+    }
+
+    void compile_group(const ast::FunctionDef& root, interp::FunctionTable& functions) {
+        struct Translation {
+            std::vector<std::uint8_t> code;
+            std::vector<FunctionCompiler::Fixup> fixups;
+        };
+        std::unordered_map<const ast::FunctionDef*, Translation> group;
+        std::vector<const ast::FunctionDef*> order;
+
+        auto ineligible = [&](const ast::FunctionDef* f) {
+            auto it = compiled_.find(f);
+            return it != compiled_.end() && !it->second.entry;
+        };
+
+        // 1) Übersetzen: Wurzel + alle erreichbaren Aufrufziele
+        std::vector<const ast::FunctionDef*> work{&root};
+        while (!work.empty()) {
+            const ast::FunctionDef* f = work.back();
+            work.pop_back();
+            if (group.count(f) || compiled_.count(f)) continue;
+
+            // Rekursive gecachte Funktionen bleiben beim Interpreter (jeder Aufruf fragt den Cache)
+            if (interp::memo().recursive(*f)) {
+                compiled_[f] = Compiled{};
+                continue;
+            }
+
+            FunctionCompiler fc(*f, functions, sites_);
+            try {
+                fc.compile();
+            } catch (const Unsupported&) {
+                compiled_[f] = Compiled{};
+                continue;
+            }
+            for (const auto& fx : fc.fixups)
+                if (fx.callee) work.push_back(fx.callee);
+            order.push_back(f);
+            group[f] = Translation{std::move(fc.code), std::move(fc.fixups)};
+        }
+
+        // 2) Wer (transitiv) Interpretiertes aufruft, wird selbst interpretiert
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (auto it = order.begin(); it != order.end();) {
+                bool bad = false;
+                for (const auto& fx : group[*it].fixups)
+                    if (fx.callee && ineligible(fx.callee)) bad = true;
+                if (bad) {
+                    compiled_[*it] = Compiled{};
+                    group.erase(*it);
+                    it = order.erase(it);
+                    changed = true;
+                } else {
+                    ++it;
+                }
+            }
+        }
+        if (order.empty()) return;
+
+        // 3) Linken: Rümpfe hintereinander, danach je ein Einstieg
+        auto give_up = [&] {
+            for (const auto* f : order) compiled_[f] = Compiled{};
+        };
+        if (!ensure_error_exit()) return give_up();
+
+        const std::int64_t chunk_base = reinterpret_cast<std::int64_t>(region_.base() + region_.used());
+        std::vector<std::uint8_t> chunk;
+        std::unordered_map<const ast::FunctionDef*, size_t> offset;
+        for (const auto* f : order) {
+            offset[f] = chunk.size();
+            const auto& code = group[f].code;
+            chunk.insert(chunk.end(), code.begin(), code.end());
+        }
+
+        auto target_of = [&](const ast::FunctionDef* callee) -> std::int64_t {
+            if (!callee) return reinterpret_cast<std::int64_t>(error_exit_);
+            auto it = offset.find(callee);
+            if (it != offset.end()) return chunk_base + static_cast<std::int64_t>(it->second);
+            return reinterpret_cast<std::int64_t>(compiled_.at(callee).body);
+        };
+        for (const auto* f : order) {
+            for (const auto& fx : group[f].fixups) {
+                size_t at = offset[f] + fx.at;
+                std::int64_t rel = target_of(fx.callee) - (chunk_base + static_cast<std::int64_t>(at + 4));
+                std::int32_t rel32 = static_cast<std::int32_t>(rel);
+                std::memcpy(&chunk[at], &rel32, 4);
+            }
+        }
+
+        std::unordered_map<const ast::FunctionDef*, size_t> entry_offset;
+        for (const auto* f : order) {
+            entry_offset[f] = chunk.size();
+            auto entry = entry_code(f->params.size(),
+                                    static_cast<std::int64_t>(offset[f]) - static_cast<std::int64_t>(chunk.size()));
+            chunk.insert(chunk.end(), entry.begin(), entry.end());
+        }
+
+        std::uint8_t* at = region_.append(chunk);
+        if (!at || reinterpret_cast<std::int64_t>(at) != chunk_base) return give_up();
+
+        for (const auto* f : order) {
+            Compiled c;
+            c.body = at + offset[f];
+            c.entry = reinterpret_cast<EntryFn>(at + entry_offset[f]);
+            compiled_[f] = c;
+        }
+        interp::stats().jit_functions += order.size();
+    }
+};
+
+// Prozessweiter JIT
+inline Jit& jit() {
+    static Jit j;
+    return j;
+}
+
+} // namespace jit
@@ -0,0 +1,167 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstdint>   // std::int32_t, std::uint8_t, ...
+#include <cstring>   // std::memcpy
+#include <initializer_list> // std::initializer_list
+#include <vector>    // std::vector
+
+namespace jit {
+
+// Minimaler x86-64-Assembler fuer den Template-JIT.
+// Kennt nur die Befehle, die der Compiler braucht; gearbeitet wird mit eax als
+// Akkumulator, ecx als zweitem Operanden, rbp als Frame-Basis und r15 als Kontextzeiger.
+class X86Assembler {
+public:
+    // Sprungziel; Sprünge vor bind() werden beim Binden nachgetragen
+    struct Label {
+        std::int64_t pos = -1;            // Position im Code (-1 = noch offen)
+        std::vector<size_t> fixups;       // rel32-Felder, die auf das Label zeigen
+    };
+
+    // Bedingungscodes (unterer Nibble von Jcc/SETcc)
+    enum class Cond : std::uint8_t {
+        E = 0x4, NE = 0x5, L = 0xC, GE = 0xD, LE = 0xE, G = 0xF
+    };
+
+    static Cond negate(Cond c) {
+        return static_cast<Cond>(static_cast<std::uint8_t>(c) ^ 1);
+    }
+
+    std::vector<std::uint8_t>& code() { return code_; }
+    size_t size() const { return code_.size(); }
+
+    void bind(Label& l) {
+        l.pos = static_cast<std::int64_t>(code_.size());
+        for (size_t at : l.fixups) patch_rel32(at, code_.size());
+        l.fixups.clear();
+    }
+
+    // ---------- Frame ----------
+    void push_rbp()        { byte(0x55); }
+    void mov_rbp_rsp()     { bytes({0x48, 0x89, 0xE5}); }
+    void sub_rsp(std::int32_t n) { bytes({0x48, 0x81, 0xEC}); imm32(n); }
+    void add_rsp(std::int32_t n) { bytes({0x48, 0x81, 0xC4}); imm32(n); }
+    void leave()           { byte(0xC9); }
+    void ret()             { byte(0xC3); }
+
+    // ---------- Akkumulator ----------
+    void mov_eax_imm(std::int32_t v) {
+        if (v == 0) bytes({0x31, 0xC0}); // xor eax, eax
+        else { byte(0xB8); imm32(v); }
+    }
+    void mov_ecx_imm(std::int32_t v) { byte(0xB9); imm32(v); }
+    void mov_eax_local(std::int32_t disp) { bytes({0x8B, 0x85}); imm32(disp); }
+    void mov_ecx_local(std::int32_t disp) { bytes({0x8B, 0x8D}); imm32(disp); }
+    void mov_local_eax(std::int32_t disp) { bytes({0x89, 0x85}); imm32(disp); }
+    void mov_ecx_eax()     { bytes({0x89, 0xC1}); }
+    void mov_eax_edx()     { bytes({0x89, 0xD0}); }
+    void push_rax()        { byte(0x50); }
+    void pop_rax()         { byte(0x58); }
+    void pop_rcx()         { byte(0x59); }
+
+    // ---------- Arithmetik (eax op= ecx) ----------
+    void add_eax_ecx()     { bytes({0x01, 0xC8}); }
+    void sub_eax_ecx()     { bytes({0x29, 0xC8}); }
+    void imul_eax_ecx()    { bytes({0x0F, 0xAF, 0xC1}); }
+    void cdq()             { byte(0x99); }
+    void idiv_ecx()        { bytes({0xF7, 0xF9}); }
+    void neg_eax()         { bytes({0xF7, 0xD8}); }
+    void xor_eax_1()       { bytes({0x83, 0xF0, 0x01}); }
+    void test_eax_eax()    { bytes({0x85, 0xC0}); }
+    void test_ecx_ecx()    { bytes({0x85, 0xC9}); }
+    void cmp_eax_ecx()     { bytes({0x39, 0xC8}); }
+
+    // eax = (Bedingung erfüllt) ? 1 : 0
+    void setcc_eax(Cond c) {
+        bytes({0x0F, static_cast<std::uint8_t>(0x90 | static_cast<std::uint8_t>(c)), 0xC0});
+        bytes({0x0F, 0xB6, 0xC0}); // movzx eax, al
+    }
+
+    // ---------- Sprünge und Aufrufe ----------
+    void jmp(Label& l)     { byte(0xE9); rel32_to(l); }
+    void jcc(Cond c, Label& l) {
+        bytes({0x0F, static_cast<std::uint8_t>(0x80 | static_cast<std::uint8_t>(c))});
+        rel32_to(l);
+    }
+
+    // call rel32; liefert die Position des rel32-Felds (wird beim Linken gesetzt)
+    size_t call_rel32() {
+        byte(0xE8);
+        size_t at = code_.size();
+        imm32(0);
+        return at;
+    }
+
+    // jmp rel32 zu einem Ziel ausserhalb des Puffers (wird beim Linken gesetzt)
+    size_t jmp_rel32() {
+        byte(0xE9);
+        size_t at = code_.size();
+        imm32(0);
+        return at;
+    }
+
+    // Absoluter Aufruf einer C++-Hilfsfunktion mit 16-Byte-ausgerichtetem Stack
+    // (rbx sichert rsp; rbx ist callee-saved und wird vom Einstieg gerettet)
+    void call_helper(const void* fn) {
+        bytes({0x48, 0x89, 0xE3});             // mov rbx, rsp
+        bytes({0x48, 0x83, 0xE4, 0xF0});       // and rsp, -16
+        bytes({0x48, 0xB8});                   // mov rax, imm64
+        imm64(reinterpret_cast<std::uint64_t>(fn));
+        bytes({0xFF, 0xD0});                   // call rax
+        bytes({0x48, 0x89, 0xDC});             // mov rsp, rbx
+    }
+
+    // ---------- Kontext (r15) ----------
+    void mov_rdi_r15()     { bytes({0x4C, 0x89, 0xFF}); }
+    void mov_esi_eax()     { bytes({0x89, 0xC6}); }
+    void mov_r15_rdi()     { bytes({0x49, 0x89, 0xFF}); }
+    void mov_ctx_rsp(std::int8_t disp) { bytes({0x49, 0x89, 0x67, static_cast<std::uint8_t>(disp)}); }
+    void mov_rsp_ctx(std::int8_t disp) { bytes({0x49, 0x8B, 0x67, static_cast<std::uint8_t>(disp)}); }
+    void mov_ctx_rax(std::int8_t disp) { bytes({0x49, 0x89, 0x47, static_cast<std::uint8_t>(disp)}); }
+    void mov_ctx_imm32(std::int8_t disp, std::int32_t v) {
+        bytes({0x41, 0xC7, 0x47, static_cast<std::uint8_t>(disp)});
+        imm32(v);
+    }
+    void cmp_ctx_zero64(std::int8_t disp) {
+        bytes({0x49, 0x83, 0x7F, static_cast<std::uint8_t>(disp), 0x00});
+    }
+
+    // push qword [rsi + disp]
+    void push_rsi_mem(std::int32_t disp) { bytes({0xFF, 0xB6}); imm32(disp); }
+
+    // callee-saved Register (Einstieg/Fehlerausgang)
+    void push_callee_saved() { bytes({0x55, 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57}); }
+    void pop_callee_saved()  { bytes({0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0x5D}); }
+
+    // Trägt ein rel32-Feld nach (Ziel = Position im selben Puffer)
+    void patch_rel32(size_t at, size_t target) {
+        std::int32_t rel = static_cast<std::int32_t>(static_cast<std::int64_t>(target) -
+                                                     static_cast<std::int64_t>(at + 4));
+        std::memcpy(&code_[at], &rel, 4);
+    }
+
+private:
+    std::vector<std::uint8_t> code_;
+
+    void byte(std::uint8_t b) { code_.push_back(b); }
+    void bytes(std::initializer_list<std::uint8_t> bs) { code_.insert(code_.end(), bs); }
+    void imm32(std::int32_t v) {
+        std::uint8_t b[4];
+        std::memcpy(b, &v, 4);
+        code_.insert(code_.end(), b, b + 4);
+    }
+    void imm64(std::uint64_t v) {
+        std::uint8_t b[8];
+        std::memcpy(b, &v, 8);
+        code_.insert(code_.end(), b, b + 8);
+    }
+    void rel32_to(Label& l) {
+        size_t at = code_.size();
+        imm32(0);
+        if (l.pos >= 0) patch_rel32(at, static_cast<size_t>(l.pos));
+        else l.fixups.push_back(at);
+    }
+};
+
+} // namespace jit
@@ -1,4 +1,5 @@
 #include "tools/dump_tokens.hpp" // optional CLI-Tool: --dump-tokens <file>
+#include "tools/options.hpp"     // command line options (--output, --input, script path)
 
 #include <fstream>   // std::ifstream
 #include <iostream>  // std::cout / std::cerr
@@ -12,10 +13,32 @@
 #include "repl/preprocess.hpp"  // strip_preprocessor_lines()
 
 #include "parser/parser.hpp"    // Parser::parse_source()
+#include "opt/tail_calls.hpp"   // opt::mark_tail_calls()
+#include "opt/inline.hpp"       // opt::inline_calls()
+#include "opt/licm.hpp"         // opt::hoist_loop_invariants()
+#include "opt/purity.hpp"       // opt::PurityAnalysis
+#include "opt/escape.hpp"       // opt::mark_frame_objects()
+#include "opt/fuse.hpp"         // opt::fuse_superinstructions()
+#include "opt/specialise.hpp"   // opt::specialise_binaries()
+#include "sem/program_analyzer.hpp" // sem::ProgramAnalyzer (type checking before execution)
+#include "codegen/cpp_emitter.hpp" // codegen::emit_cpp (--emit-cpp)
+#include "codegen/native.hpp"      // codegen::build_native (--native)
 
 #include "interp/env.hpp"       // runtime environment (scopes + refs)
 #include "interp/exec.hpp"      // eval/exec + call_function
 #include "interp/functions.hpp" // FunctionTable + overload resolution
+#include "interp/output.hpp"    // buffered output of the print_* builtins
+#include "interp/input.hpp"     // buffered input of the read_* builtins
+#include "interp/profiler.hpp"  // --profile
+#include "interp/sampler.hpp"   // --sample-profile
+#include "interp/line_profiler.hpp" // --line-profile
+#include "interp/trace.hpp"     // --trace
+#include "interp/stats.hpp"     // --stats
+#include "interp/heap_profiler.hpp" // --heap-profile
+#include "interp/limits.hpp"    // --max-steps, --max-depth, --timeout-ms, --max-heap-mb
+#include "interp/native_stack.hpp" // --stack-mb
+#include "interp/exec_options.hpp"  // --no-tco
+#include "interp/call_labels.hpp" // names for profiling reports
 
 #include "ast/program.hpp"  // ast::Program
 #include "ast/function.hpp" // ast::FunctionDef
@@ -70,16 +93,99 @@ static int run_main_if_present(interp::Env& session_env, interp::FunctionTable&
     return 0;
 }
 
-int main(int argc, char** argv) {
-    // Early-out: debug mode prints tokens and stops normal execution
-    if (mini_cpp::maybe_dump_tokens(argc, argv)) return 0;
+// Writes all requested profiling reports (called on every exit path).
+static void write_reports(const mini_cpp::Options& opts, const interp::FunctionTable& ft) {
+    if (!mini_cpp::profiling_requested(opts)) return;
+
+    interp::CallLabels labels = interp::build_call_labels(ft);
+
+    if (opts.profile) interp::profiler().write_text(std::cerr, labels);
+
+    if (opts.line_profile) interp::line_profiler().write_text(std::cerr);
+
+    if (opts.stats) {
+        interp::stats().write_text(std::cerr);
+        interp::memo().write_text(std::cerr);
+    }
+
+    if (opts.heap_profile) interp::heap_profiler().write_text(std::cerr, labels);
+
+    if (!opts.trace_path.empty()) {
+        std::ofstream out(opts.trace_path);
+        if (!out) {
+            std::cerr << "FEHLER: konnte Trace nicht schreiben: " << opts.trace_path << "\n";
+        } else {
+            interp::tracer().write_json(out, labels);
+        }
+    }
+
+    if (opts.sample_hz > 0) {
+        interp::sampler().stop();
+        std::ofstream out(opts.sample_out);
+        if (!out) {
+            std::cerr << "FEHLER: konnte Samples nicht schreiben: " << opts.sample_out << "\n";
+        } else {
+            interp::sampler().write_folded(out, labels);
+            if (interp::sampler().dropped() > 0)
+                std::cerr << "Hinweis: " << interp::sampler().dropped()
+                          << " Samples verworfen (Puffer voll)\n";
+        }
+    }
+
+    if (!opts.profile_json.empty()) {
+        std::ofstream out(opts.profile_json);
+        if (!out) {
+            std::cerr << "FEHLER: konnte Profil nicht schreiben: " << opts.profile_json << "\n";
+            return;
+        }
+        interp::profiler().write_json(out, labels);
+    }
+}
+
+// Exit code when an execution limit was exceeded (distinct from ordinary errors = 1)
+static constexpr int kExitLimitExceeded = 3;
+
+// Runs the interpreter (file and/or REPL); returns the process exit code.
+static int run_interpreter(int argc, char** argv) {
+    mini_cpp::Options opts;
+
+    // Global program holds parsed global definitions (classes + functions)
+    ast::Program global_program;
+
+    // Runtime tables (functions + class runtime metadata)
+    interp::FunctionTable functions;
 
     try {
-        // Global program holds parsed global definitions (classes + functions)
-        ast::Program global_program;
+        opts = mini_cpp::parse_options(argc, argv);
+
+        if (opts.profile || !opts.profile_json.empty()) interp::profiler().enable();
+        if (opts.sample_hz > 0) interp::sampler().start(opts.sample_hz);
+        if (opts.line_profile) interp::line_profiler().enable();
+        if (opts.heap_profile) interp::heap_profiler().enable();
+        if (!opts.trace_path.empty())
+            interp::tracer().enable(static_cast<std::uint64_t>(opts.trace_threshold_us));
+
+        interp::exec_options().tail_calls = !opts.no_tco;
+#if defined(__x86_64__)
+        interp::exec_options().jit = !opts.no_jit && !mini_cpp::per_call_instrumentation(opts);
+#endif
+        // Line and heap profiles need the statements of the tree interpreter
+        if (opts.engine == "closure" && !opts.line_profile && !opts.heap_profile)
+            interp::exec_options().engine = interp::Engine::Closure;
+
+        // Execution limits (0 = unlimited)
+        interp::limits().set_max_steps(opts.max_steps);
+        interp::limits().set_max_depth(static_cast<size_t>(opts.max_depth));
+        interp::limits().set_timeout_ms(opts.timeout_ms);
+        interp::limits().set_max_heap_bytes(opts.max_heap_mb * 1024 * 1024);
+        interp::exec_options().statement_hooks =
+            opts.line_profile || opts.heap_profile || interp::limits().active();
+
+        // Redirect builtin output directly to a file descriptor
+        if (!opts.output_path.empty()) interp::output().open_file(opts.output_path);
 
-        // Runtime tables (functions + class runtime metadata)
-        interp::FunctionTable functions;
+        // Read builtin input from a file instead of stdin
+        if (!opts.input_path.empty()) interp::input().open_file(opts.input_path);
 
         // Two environments:
         // - global_env: root scope
@@ -87,30 +193,91 @@ int main(int argc, char** argv) {
         interp::Env global_env(nullptr);
         interp::Env session_env(&global_env);
 
-        // Optional: load and run a file if a non-flag argument is provided
-        if (argc > 1) {
-            std::string path = argv[1];
+        // Optional: load and run a file if a script path is provided
+        if (!opts.script_path.empty()) {
+            // Read + preprocess (strip #include etc.)
+            std::string src = read_file_or_throw(opts.script_path);
+            src = repl::strip_preprocessor_lines(src);
+            if (opts.line_profile) interp::line_profiler().set_source(src);
 
-            // Treat argv[1] as a file path only if it doesn't look like an option
-            if (!path.empty() && path[0] != '-') {
-                // Read + preprocess (strip #include etc.)
-                std::string src = read_file_or_throw(path);
-                src = repl::strip_preprocessor_lines(src);
-
-                // Parse the whole file into a Program and build runtime tables from it
+            // Parse the whole file into a Program and build runtime tables from it
+            {
+                interp::TracePhase trace("parse");
                 global_program = parser::Parser::parse_source(src);
+            }
+            opt::mark_tail_calls(global_program);
 
-                functions.add_program(global_program);
+            // Type check before execution; records static types for the fast paths.
+            // The C++ emitter requires a well-typed program (even with --no-sem).
+            const bool codegen_requested = !opts.emit_cpp_path.empty() || opts.native;
+            if (!opts.no_sem || codegen_requested) {
+                interp::TracePhase trace("sema");
+                sem::ProgramAnalyzer analyzer;
+                analyzer.analyze(global_program);
+                // Without static types the emitter cannot see which overload or result type the
+                // interpreter would pick at run time: refuse instead of translating a different program
+                if (codegen_requested && !analyzer.annotated())
+                    throw std::runtime_error(
+                        "--emit-cpp/--native: Overloads bzw. Feldtypen hängen vom dynamischen Objekttyp ab "
+                        "(statische Typen nicht verlässlich), das Programm läuft nur im Interpreter");
+            }
 
-                int exit_code = 0;
+            // Ahead of time: translate to C++ instead of interpreting
+            if (codegen_requested) {
+                std::string cpp = codegen::emit_cpp(global_program);
+                if (!opts.emit_cpp_path.empty()) {
+                    std::ofstream out(opts.emit_cpp_path);
+                    if (!out || !(out << cpp))
+                        throw std::runtime_error("konnte C++-Datei nicht schreiben: " + opts.emit_cpp_path);
+                }
+                if (!opts.native) return 0;
 
-                // If the file defines main(), run it once
-                if (has_main(global_program)) {
-                    exit_code = run_main_if_present(session_env, functions);
+                std::string binary;
+                {
+                    interp::TracePhase trace("native-build");
+                    binary = codegen::build_native(cpp);
                 }
+                // Deep recursion in the generated code needs the same stack as the interpreter
+                return codegen::run_process({binary}, opts.input_path, opts.output_path,
+                                            opts.stack_mb << 20);
+            }
+
+            functions.add_program(global_program);
+
+            // --memoize: cache pure functions (not with profilers/limits, where every call counts)
+            if (opts.memoize && !mini_cpp::per_call_instrumentation(opts)) {
+                opt::PurityAnalysis purity;
+                for (const ast::FunctionDef* f : purity.run(global_program))
+                    interp::memo().enable(*f, purity.recursive(*f));
+            }
+
+            // Optimisations on the static types (inlining needs the class hierarchy)
+            if (!opts.no_sem) {
+                interp::TracePhase trace("opt");
+                // Inlined calls count neither calls nor statements, LICM adds statements and
+                // frame objects are missing from the heap profile: none of it with profilers/limits
+                if (!mini_cpp::per_call_instrumentation(opts)) {
+                    opt::mark_frame_objects(global_program);
+                    opt::inline_calls(global_program, functions.class_rt, opts.inline_size);
+                    if (!opts.no_licm) opt::hoist_loop_invariants(global_program, functions.class_rt);
+                }
+                opt::fuse_superinstructions(global_program);
+                opt::specialise_binaries(global_program);
+            }
+
+            int exit_code = 0;
+
+            // If the file defines main(), run it once
+            if (has_main(global_program)) {
+                interp::TracePhase trace("execute");
+                exit_code = run_main_if_present(session_env, functions);
+            }
 
-                // In CI/tests stdin ist typischerweise kein TTY -> keine REPL starten
-                if (!isatty(0)) return exit_code;
+            // In CI/tests stdin is usually not a TTY -> do not start the REPL
+            if (!isatty(0)) {
+                interp::output().flush();
+                write_reports(opts, functions);
+                return exit_code;
             }
         } else {
             // No file: start with an empty program, but still build the runtime tables
@@ -118,9 +285,40 @@ int main(int argc, char** argv) {
         }
 
         // Start interactive REPL with current program + runtime tables + environments
-        return repl::run_repl(global_program, functions, global_env, session_env);
+        int rc = repl::run_repl(global_program, functions, global_env, session_env);
+        interp::output().flush();
+        write_reports(opts, functions);
+        return rc;
+    } catch (const std::exception& ex) {
+        // Top-level error handling for file loading/parsing/runtime init.
+        // Output printed before the error must appear before the message.
+        try {
+            interp::output().flush();
+        } catch (const std::exception&) {
+        }
+        std::cerr << "FEHLER: " << ex.what() << "\n";
+        write_reports(opts, functions);
+        return dynamic_cast<const interp::LimitExceeded*>(&ex) ? kExitLimitExceeded : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    // Early-out: debug mode prints tokens and stops normal execution
+    if (mini_cpp::maybe_dump_tokens(argc, argv)) return 0;
+
+    // Deep script recursion needs a large native stack: run the interpreter on a
+    // dedicated thread (option errors are reported by run_interpreter itself)
+    std::uint64_t stack_mb = mini_cpp::Options{}.stack_mb;
+    try {
+        stack_mb = mini_cpp::parse_options(argc, argv).stack_mb;
+    } catch (const std::exception&) {
+    }
+    if (stack_mb == 0) return run_interpreter(argc, argv);
+
+    try {
+        return interp::NativeStack::run(static_cast<size_t>(stack_mb) << 20,
+                                        [&] { return run_interpreter(argc, argv); });
     } catch (const std::exception& ex) {
-        // Top-level error handling for file loading/parsing/runtime init
         std::cerr << "FEHLER: " << ex.what() << "\n";
         return 1;
     }
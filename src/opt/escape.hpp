@@ -0,0 +1,132 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <unordered_set> // std::unordered_set
+#include <utility>       // std::pair
+#include <vector>        // std::vector
+
+#include "../ast/program.hpp"   // ast::Program
+#include "../ast/function.hpp"  // ast::Param
+#include "../ast/stmt.hpp"      // Statements
+#include "../ast/expr.hpp"      // Ausdrücke
+#include "walker.hpp"           // AstWalker
+
+namespace opt {
+
+// Escape-Analyse für Klassen-Locals (T x; / T x = expr;): ein Objekt entkommt, wenn ein
+// Zeiger darauf den Frame überleben könnte. Der Interpreter teilt ObjectPtr ohne Kopie bei
+// return-Werten, Argumenten (Wert- und Referenzparameter), Feldzuweisungen (o.f = x),
+// Referenzen (T& r = x) und Zuweisungen an Referenzen. Unbedenklich sind nur
+//   x.f, x.f = v, x.m(...)   (Empfänger: Methoden können ihr Objekt nicht herausgeben)
+//   T y = x; / y = x;        (y eine Klassenvariable ohne &: tiefe Kopie)
+// Jede andere Verwendung von x als Wert lässt das Objekt entkommen. Nicht entkommende
+// Locals direkt in einem Block markiert die Analyse (VarDeclStmt::frame_object, dazu
+// BlockStmt::frame_objects); ihr Objekt liegt dann im Stack-Frame, der den Block ausführt,
+// ohne Heap-Allokation und Referenzzählung.
+// Setzt statisch aufgelöste Namen voraus (semantische Analyse): ohne sie könnte eine
+// aufgerufene Funktion Variablen des Aufrufers über die Env-Kette lesen.
+class EscapeAnalysis : public AstWalker {
+protected:
+    void body(const std::vector<ast::Param>& params, ast::StmtPtr& body) override {
+        scopes_.assign(1, {});
+        candidates_.clear();
+        escaped_.clear();
+        block_ = nullptr;
+        for (const auto& p : params)
+            scopes_.back()[p.name] = Decl{nullptr, is_class_value(p.type)};
+        stmt(body);
+        for (auto [v, block] : candidates_) {
+            v->frame_object = !escaped_.count(v);
+            if (v->frame_object) block->frame_objects = true;
+        }
+        scopes_.clear();
+    }
+
+    void stmt(ast::StmtPtr& s) override {
+        using namespace ast;
+        // Direkt im Block? (sonst Zweig ohne {}: deklariert im umgebenden Env, bei Schleifen
+        // einmal pro Durchlauf)
+        BlockStmt* block = block_;
+        block_ = nullptr;
+        if (auto* b = dynamic_cast<BlockStmt*>(s.get())) {
+            scopes_.emplace_back();
+            for (auto& st : b->statements) {
+                block_ = b;
+                stmt(st);
+            }
+            scopes_.pop_back();
+        } else if (auto* v = dynamic_cast<VarDeclStmt*>(s.get())) {
+            const bool candidate = is_class_value(v->decl_type) && block;
+            if (v->init) {
+                if (is_class_value(v->decl_type)) copy_source(v->init);
+                else expr(v->init);
+            }
+            scopes_.back()[v->name] = Decl{candidate ? v : nullptr, is_class_value(v->decl_type)};
+            if (candidate) candidates_.emplace_back(v, block);
+        } else {
+            children(*s);
+        }
+    }
+
+    // Ausdruck, dessen Wert weitergegeben werden kann (Argumente: Wert- und Referenzparameter)
+    void expr(ast::ExprPtr& e) override {
+        using namespace ast;
+        if (auto* v = dynamic_cast<VarExpr*>(e.get())) {
+            escape(v->name);
+        } else if (auto* a = dynamic_cast<AssignExpr*>(e.get())) {
+            const Decl* target = lookup(a->name);
+            if (target && target->class_value) copy_source(a->value);
+            else expr(a->value);
+        } else {
+            children(*e);
+        }
+    }
+
+    // Objekt eines Feldzugriffs oder Methodenaufrufs
+    void receiver(ast::ExprPtr& e) override {
+        if (!dynamic_cast<const ast::VarExpr*>(e.get())) expr(e);
+    }
+
+private:
+    // Deklaration eines Namens im Rumpf
+    struct Decl {
+        ast::VarDeclStmt* local = nullptr; // Kandidat (Klassen-Local ohne &)
+        bool class_value = false;          // Klassentyp ohne & (Zuweisung kopiert tief)
+    };
+
+    std::vector<std::unordered_map<std::string, Decl>> scopes_;
+    std::vector<std::pair<ast::VarDeclStmt*, ast::BlockStmt*>> candidates_; // Local + sein Block
+    std::unordered_set<const ast::VarDeclStmt*> escaped_;
+    ast::BlockStmt* block_ = nullptr; // Block, in dem das nächste Statement direkt steht
+
+    static bool is_class_value(const ast::Type& t) {
+        return t.base == ast::Type::Base::Class && !t.is_ref;
+    }
+
+    const Decl* lookup(const std::string& name) const {
+        for (auto it = scopes_.rbegin(); it != scopes_.rend(); ++it) {
+            auto d = it->find(name);
+            if (d != it->end()) return &d->second;
+        }
+        return nullptr; // Feld des Empfängers
+    }
+
+    void escape(const std::string& name) {
+        const Decl* d = lookup(name);
+        if (d && d->local) escaped_.insert(d->local);
+    }
+
+    // Quelle einer tiefen Kopie: die Variable selbst entkommt nicht
+    void copy_source(ast::ExprPtr& e) {
+        if (!dynamic_cast<const ast::VarExpr*>(e.get())) expr(e);
+    }
+};
+
+// Markiert alle nicht entkommenden Klassen-Locals eines Programms
+inline void mark_frame_objects(ast::Program& p) {
+    EscapeAnalysis().run(p);
+}
+
+} // namespace opt
@@ -0,0 +1,182 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <memory>      // std::unique_ptr
+#include <string>      // std::string
+#include <type_traits> // std::is_same_v
+
+#include "../ast/program.hpp"          // ast::Program
+#include "../ast/stmt.hpp"             // Statements
+#include "../ast/expr.hpp"             // Ausdrücke
+#include "../interp/fused_nodes.hpp"   // Superinstruktionen
+#include "../interp/stats.hpp"         // Zähler (--stats)
+#include "walker.hpp"                  // AstWalker
+
+namespace opt {
+
+// Erkennt häufige Muster über Variablen und ersetzt sie durch Superinstruktionen:
+//   a < b, a == b, ...  (zwei Variablen oder Variable + Literal; Bedingungen von while/if)
+//   a + b, ...          (zwei int-Variablen, z.B. return a + b)
+//   x = x + y, i = i + 1, ...
+// Setzt die statischen Typen der semantischen Analyse voraus und läuft vor
+// opt::specialise_binaries (bereits fusionierte Knoten bleiben dort unverändert).
+class SuperinstructionFuser : public AstWalker {
+protected:
+    // Fusionierte Knoten enthalten nur noch Variablen und Literale
+    void expr(ast::ExprPtr& e) override {
+        using namespace ast;
+        if (auto* b = dynamic_cast<BinaryExpr*>(e.get())) {
+            if (fuse_binary(e, *b)) return;
+        } else if (auto* a = dynamic_cast<AssignExpr*>(e.get())) {
+            if (fuse_update(e, *a)) return;
+        }
+        children(*e);
+    }
+
+private:
+    using Base = ast::Type::Base;
+    using Op = ast::BinaryExpr::Op;
+
+    // Variable mit statischem Basistyp b
+    static const ast::VarExpr* typed_var(const ast::Expr& e, Base b) {
+        auto* v = dynamic_cast<const ast::VarExpr*>(&e);
+        return v && v->typed && v->static_type.base == b ? v : nullptr;
+    }
+
+    static bool is_arith(Op op) {
+        return op == Op::Add || op == Op::Sub || op == Op::Mul || op == Op::Div || op == Op::Mod;
+    }
+
+    // ---------- a OP b / a OP c ----------
+
+    bool fuse_binary(ast::ExprPtr& e, ast::BinaryExpr& b) {
+        using namespace ast;
+        if (b.specialised != Expr::Specialised::No || !b.typed) return false;
+        if (!b.left->typed) return false;
+        const Base t = b.left->static_type.base;
+        if (!typed_var(*b.left, t)) return false;
+
+        std::unique_ptr<interp::SpecialisedBinary> node;
+        if (typed_var(*b.right, t)) {
+            switch (t) {
+                case Base::Int:    node = is_arith(b.op) ? var_var_arith(b.op) : var_var_cmp<int>(b.op); break;
+                case Base::Char:   node = var_var_cmp<char>(b.op); break;
+                case Base::Bool:   node = var_var_cmp<bool>(b.op); break;
+                case Base::String: node = var_var_cmp<std::string>(b.op); break;
+                default: break;
+            }
+        } else if (auto* i = dynamic_cast<const IntLiteral*>(b.right.get()); i && t == Base::Int) {
+            node = var_const_cmp<int>(b.op, i->value);
+        } else if (auto* c = dynamic_cast<const CharLiteral*>(b.right.get()); c && t == Base::Char) {
+            node = var_const_cmp<char>(b.op, c->value);
+        }
+        if (!node) return false;
+
+        node->loc = b.loc;
+        node->static_type = b.static_type;
+        node->typed = true;
+        node->specialised = Expr::Specialised::Binary;
+        node->op = b.op;
+        node->left = std::move(b.left);
+        node->right = std::move(b.right);
+        e = std::move(node);
+        ++interp::stats().fused_sites;
+        return true;
+    }
+
+    static std::unique_ptr<interp::SpecialisedBinary> var_var_arith(Op op) {
+        using namespace interp;
+        switch (op) {
+            case Op::Add: return std::make_unique<VarVarArith<AddOp>>();
+            case Op::Sub: return std::make_unique<VarVarArith<SubOp>>();
+            case Op::Mul: return std::make_unique<VarVarArith<MulOp>>();
+            case Op::Div: return std::make_unique<VarVarArith<DivOp>>();
+            case Op::Mod: return std::make_unique<VarVarArith<ModOp>>();
+            default:      return nullptr;
+        }
+    }
+
+    // <, <=, >, >= nur fuer int/char, == / != fuer alle primitiven Typen
+    template <class T>
+    static std::unique_ptr<interp::SpecialisedBinary> var_var_cmp(Op op) {
+        using namespace interp;
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, char>) {
+            switch (op) {
+                case Op::Lt: return std::make_unique<VarVarCmp<Lt, T>>();
+                case Op::Le: return std::make_unique<VarVarCmp<Le, T>>();
+                case Op::Gt: return std::make_unique<VarVarCmp<Gt, T>>();
+                case Op::Ge: return std::make_unique<VarVarCmp<Ge, T>>();
+                default: break;
+            }
+        }
+        switch (op) {
+            case Op::Eq: return std::make_unique<VarVarCmp<Eq, T>>();
+            case Op::Ne: return std::make_unique<VarVarCmp<Ne, T>>();
+            default:     return nullptr;
+        }
+    }
+
+    template <class T>
+    static std::unique_ptr<interp::SpecialisedBinary> var_const_cmp(Op op, T c) {
+        using namespace interp;
+        switch (op) {
+            case Op::Lt: return std::make_unique<VarConstCmp<Lt, T>>(c);
+            case Op::Le: return std::make_unique<VarConstCmp<Le, T>>(c);
+            case Op::Gt: return std::make_unique<VarConstCmp<Gt, T>>(c);
+            case Op::Ge: return std::make_unique<VarConstCmp<Ge, T>>(c);
+            case Op::Eq: return std::make_unique<VarConstCmp<Eq, T>>(c);
+            case Op::Ne: return std::make_unique<VarConstCmp<Ne, T>>(c);
+            default:     return nullptr;
+        }
+    }
+
+    // ---------- x = x OP y / x = x OP c ----------
+
+    bool fuse_update(ast::ExprPtr& e, ast::AssignExpr& a) {
+        using namespace ast;
+        if (a.specialised != Expr::Specialised::No || !a.typed || a.static_type.base != Base::Int) return false;
+
+        auto* b = dynamic_cast<BinaryExpr*>(a.value.get());
+        if (!b || !b->typed || !is_arith(b->op)) return false;
+        const VarExpr* x = typed_var(*b->left, Base::Int);
+        if (!x || x->name != a.name) return false;
+
+        std::unique_ptr<interp::FusedAssign> node;
+        if (const VarExpr* y = typed_var(*b->right, Base::Int)) {
+            node = update<interp::VarUpdateVar>(b->op, y->name);
+        } else if (auto* c = dynamic_cast<const IntLiteral*>(b->right.get())) {
+            node = update<interp::VarUpdateConst>(b->op, c->value);
+        }
+        if (!node) return false;
+
+        node->loc = a.loc;
+        node->static_type = a.static_type;
+        node->typed = true;
+        node->specialised = Expr::Specialised::Assign;
+        node->name = a.name;
+        node->value = std::move(a.value);
+        e = std::move(node);
+        ++interp::stats().fused_sites;
+        return true;
+    }
+
+    template <template <class> class Node, class Arg>
+    static std::unique_ptr<interp::FusedAssign> update(Op op, Arg arg) {
+        using namespace interp;
+        switch (op) {
+            case Op::Add: return std::make_unique<Node<AddOp>>(arg);
+            case Op::Sub: return std::make_unique<Node<SubOp>>(arg);
+            case Op::Mul: return std::make_unique<Node<MulOp>>(arg);
+            case Op::Div: return std::make_unique<Node<DivOp>>(arg);
+            case Op::Mod: return std::make_unique<Node<ModOp>>(arg);
+            default:      return nullptr;
+        }
+    }
+};
+
+// Fusioniert alle Funktions-, Methoden- und Konstruktorrümpfe eines Programms
+inline void fuse_superinstructions(ast::Program& p) {
+    SuperinstructionFuser().run(p);
+}
+
+} // namespace opt
@@ -0,0 +1,347 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstddef>       // std::size_t
+#include <memory>        // std::unique_ptr
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+#include "../ast/program.hpp"          // ast::Program
+#include "../ast/class.hpp"            // ast::ClassDef, ast::MethodDef
+#include "../ast/stmt.hpp"             // Statements
+#include "../ast/expr.hpp"             // Ausdrücke
+#include "../interp/inline_nodes.hpp"  // InlinedCall, InlinedMethodCall, InlineNode
+#include "../interp/class_runtime.hpp" // ClassRuntime (Klassenhierarchie-Analyse)
+#include "../interp/stats.hpp"         // Zähler (--stats)
+#include "../sem/analyzer.hpp"         // sem::Analyzer::builtin_signature
+#include "walker.hpp"                  // AstWalker
+
+namespace opt {
+
+// Ersetzt Aufrufe kleiner Funktionen und direkt aufrufbarer Methoden (Getter/Setter, kurze
+// Rechenfunktionen) durch eine Kopie ihres Rumpfs an der Aufrufstelle.
+// Voraussetzungen (sonst bleibt der gewöhnliche Aufruf):
+// - typgeprüfter Aufruf, Ziel statisch eindeutig: alle Parameter primitiv (die Overload-
+//   Auflösung zur Laufzeit sieht dann dieselben Typen), Methoden über eine Variable
+//   aufgerufen und nicht virtuell bzw. laut Klassenhierarchie-Analyse (VtableEntry::
+//   direct) ohne Überschreibung in abgeleiteten Klassen
+// - Rumpf: Ausdrucksstatements, optional gefolgt von return expr; höchstens max_size
+//   AST-Knoten, keine Aufrufe, keine Deklarationen, kein / oder % (der Rumpf kann nicht
+//   fehlschlagen, Fehlermeldungen und Positionen bleiben unverändert)
+// - Referenzparameter: Argument ist eine Variable; sie ersetzt den Parameter im Rumpf,
+//   Lesen und Schreiben wirken also wie über die Referenz auf die Variable des Aufrufers
+// - Wertparameter werden vor dem Rumpf einmal ausgewertet und nicht zugewiesen
+// Läuft vor opt::fuse_superinstructions / opt::specialise_binaries auf dem unveränderten AST.
+// Ergänzt der REPL Klassen, entfallen die statischen Typen und damit alle Inline-Aufrufe.
+class CallInliner : public AstWalker {
+public:
+    CallInliner(const ast::Program& p, const interp::ClassRuntime& rt, int max_size)
+        : rt_(rt), max_size_(max_size) {
+        for (const auto& c : p.classes) classes_.emplace(c.name, &c);
+        for (const auto& f : p.functions) functions_[f.name].push_back(&f);
+    }
+
+protected:
+    void stmt(ast::StmtPtr& s) override {
+        children(*s);
+        // Inline-Rümpfe enthalten keine Aufrufe: kein Tail-Call mehr
+        if (auto* r = dynamic_cast<ast::ReturnStmt*>(s.get()))
+            if (r->value && r->value->specialised != ast::Expr::Specialised::No) r->tail_call = false;
+    }
+
+    // Kinder zuerst, danach ggf. den Aufruf selbst ersetzen
+    void expr(ast::ExprPtr& e) override {
+        children(*e);
+        if (auto* c = dynamic_cast<ast::CallExpr*>(e.get())) inline_call(e, *c);
+        else if (auto* mc = dynamic_cast<ast::MethodCallExpr*>(e.get())) inline_method_call(e, *mc);
+    }
+
+private:
+    using Base = ast::Type::Base;
+
+    const interp::ClassRuntime& rt_;
+    int max_size_;
+    std::unordered_map<std::string, const ast::ClassDef*> classes_;
+    std::unordered_map<std::string, std::vector<const ast::FunctionDef*>> functions_;
+
+    static bool is_primitive(const ast::Type& t) {
+        return t.base == Base::Int || t.base == Base::Bool || t.base == Base::Char || t.base == Base::String;
+    }
+
+    // Parameterliste passt zu den (typgeprüften, primitiven) Argumenten – Regeln wie
+    // FunctionTable::resolve bzw. ClassRuntime::find_overload_in_class
+    static bool params_match(const std::vector<ast::Param>& params, const std::vector<ast::ExprPtr>& args) {
+        if (params.size() != args.size()) return false;
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            ast::Type pt = params[i].type;
+            pt.is_ref = false;
+            if (pt != args[i]->static_type) return false;
+            if (params[i].type.is_ref && !dynamic_cast<const ast::VarExpr*>(args[i].get()) &&
+                !dynamic_cast<const ast::MemberAccessExpr*>(args[i].get()))
+                return false;
+        }
+        return true;
+    }
+
+    static bool args_primitive(const std::vector<ast::ExprPtr>& args) {
+        for (const auto& a : args)
+            if (!a->typed || !is_primitive(a->static_type)) return false;
+        return true;
+    }
+
+    // ---------- f(args) ----------
+
+    void inline_call(ast::ExprPtr& e, ast::CallExpr& c) {
+        using namespace ast;
+        if (c.specialised != Expr::Specialised::No || !c.typed || !args_primitive(c.args)) return;
+
+        sem::FuncSymbol builtin;
+        if (sem::Analyzer::builtin_signature(c.callee, builtin)) return;
+
+        auto it = functions_.find(c.callee);
+        if (it == functions_.end()) return;
+        const FunctionDef* target = nullptr;
+        for (const FunctionDef* f : it->second) {
+            if (!params_match(f->params, c.args)) continue;
+            if (target) return; // mehrdeutig: Fehler bleibt dem Interpreter
+            target = f;
+        }
+        if (!target || !target->body) return;
+
+        auto node = std::make_unique<interp::InlinedCall>();
+        if (!build_body(target->params, *target->body, target->return_type, c.args, false, node->body))
+            return;
+
+        node->loc = c.loc;
+        node->static_type = c.static_type;
+        node->typed = true;
+        node->specialised = Expr::Specialised::InlinedCall;
+        node->callee = c.callee;
+        node->args = std::move(c.args);
+        node->target = target;
+        e = std::move(node);
+        ++interp::stats().inlined_calls;
+    }
+
+    // ---------- obj.m(args) ----------
+
+    void inline_method_call(ast::ExprPtr& e, ast::MethodCallExpr& mc) {
+        using namespace ast;
+        if (mc.specialised != Expr::Specialised::No || !mc.typed || !args_primitive(mc.args)) return;
+
+        // Empfänger über eine Variable: statische Klasse wie in resolve_method_call
+        auto* recv = dynamic_cast<const VarExpr*>(mc.object.get());
+        if (!recv || !recv->typed || recv->static_type.base != Base::Class) return;
+
+        const MethodDef* target = find_direct(recv->static_type.class_name, mc.method, mc.args);
+        if (!target || !target->body) return;
+
+        auto node = std::make_unique<interp::InlinedMethodCall>();
+        if (!build_body(target->params, *target->body, target->return_type, mc.args, true, node->body))
+            return;
+
+        node->loc = mc.loc;
+        node->static_type = mc.static_type;
+        node->typed = true;
+        node->specialised = Expr::Specialised::InlinedMethod;
+        node->object = std::move(mc.object);
+        node->method = mc.method;
+        node->args = std::move(mc.args);
+        node->target = target;
+        e = std::move(node);
+        ++interp::stats().inlined_calls;
+    }
+
+    const ast::ClassDef* class_def(const std::string& name) const {
+        auto it = classes_.find(name);
+        return it != classes_.end() ? it->second : nullptr;
+    }
+
+    // Overload-Suche entlang der Vererbungskette (wie ClassRuntime::resolve_method);
+    // nullptr, wenn nicht eindeutig oder virtueller Dispatch nötig ist
+    const ast::MethodDef* find_direct(const std::string& static_class,
+                                      const std::string& method,
+                                      const std::vector<ast::ExprPtr>& args) const {
+        const ast::MethodDef* picked = nullptr;
+        for (const ast::ClassDef* c = class_def(static_class); c && !picked; c = class_def(c->base_name)) {
+            for (const auto& m : c->methods) {
+                if (m.name != method || !params_match(m.params, args)) continue;
+                if (picked) return nullptr;
+                picked = &m;
+            }
+        }
+        if (!picked) return nullptr;
+
+        // Direkt: der Owner in der statischen Klasse ist die gefundene Methode
+        const std::string key = interp::ClassRuntime::sig_key(picked->name, picked->params);
+        return rt_.dispatch_is_static(static_class, key) ? picked : nullptr;
+    }
+
+    // ---------- Rumpf kopieren ----------
+
+    // Ersetzungen beim Kopieren eines Rumpfs
+    struct Binding {
+        const std::vector<ast::Param>* params = nullptr;
+        const std::vector<ast::ExprPtr>* args = nullptr;
+        std::vector<std::size_t> slot;   // Wertparameter => Index im InlineFrame
+        bool method = false;             // andere Namen sind Felder des Empfängers
+        int size = 0;                    // kopierte Knoten
+
+        int param_index(const std::string& name) const {
+            for (std::size_t i = 0; i < params->size(); ++i)
+                if ((*params)[i].name == name) return static_cast<int>(i);
+            return -1;
+        }
+    };
+
+    bool build_body(const std::vector<ast::Param>& params, const ast::Stmt& body,
+                    const ast::Type& return_type, const std::vector<ast::ExprPtr>& args,
+                    bool method, interp::InlineBody& out) const {
+        using namespace ast;
+        if (max_size_ <= 0) return false;
+
+        Binding bind;
+        bind.params = &params;
+        bind.args = &args;
+        bind.method = method;
+        std::size_t value_params = 0;
+        for (std::size_t i = 0; i < params.size(); ++i) {
+            const bool by_value = !params[i].type.is_ref;
+            if (!by_value && !dynamic_cast<const VarExpr*>(args[i].get())) return false;
+            out.by_value.push_back(by_value);
+            bind.slot.push_back(by_value ? value_params++ : 0);
+        }
+        if (value_params > interp::kMaxInlineParams) return false;
+
+        auto* block = dynamic_cast<const BlockStmt*>(&body);
+        if (!block) return false;
+        bind.size = 1;
+
+        const auto& sts = block->statements;
+        for (std::size_t i = 0; i < sts.size(); ++i) {
+            ++bind.size;
+            if (auto* es = dynamic_cast<const ExprStmt*>(sts[i].get())) {
+                ExprPtr e = clone(*es->expr, bind);
+                if (!e) return false;
+                out.effects.push_back(std::move(e));
+            } else if (auto* r = dynamic_cast<const ReturnStmt*>(sts[i].get()); r && i + 1 == sts.size()) {
+                if (r->value) {
+                    out.result = clone(*r->value, bind);
+                    if (!out.result) return false;
+                }
+            } else {
+                return false;
+            }
+            if (bind.size > max_size_) return false;
+        }
+
+        // Nicht-void ohne return: Default-Wert wie im Interpreter – dann kein Inlining
+        return return_type.base == Base::Void || out.result;
+    }
+
+    template <class Node>
+    static std::unique_ptr<Node> with_meta(std::unique_ptr<Node> n, const ast::Expr& from) {
+        n->loc = from.loc;
+        n->static_type = from.static_type;
+        n->typed = true;
+        return n;
+    }
+
+    template <class Node>
+    static std::unique_ptr<Node> inline_node(std::unique_ptr<Node> n, const ast::Expr& from) {
+        n = with_meta(std::move(n), from);
+        n->specialised = ast::Expr::Specialised::Inline;
+        return n;
+    }
+
+    // Kopie eines Ausdrucks aus dem Rumpf; nullptr => nicht inline-fähig
+    ast::ExprPtr clone(const ast::Expr& e, Binding& b) const {
+        using namespace ast;
+        if (!e.typed || e.specialised != Expr::Specialised::No) return nullptr;
+        if (++b.size > max_size_) return nullptr;
+
+        if (auto* i = dynamic_cast<const IntLiteral*>(&e))
+            return with_meta(std::make_unique<IntLiteral>(i->value), e);
+        if (auto* bl = dynamic_cast<const BoolLiteral*>(&e))
+            return with_meta(std::make_unique<BoolLiteral>(bl->value), e);
+        if (auto* c = dynamic_cast<const CharLiteral*>(&e))
+            return with_meta(std::make_unique<CharLiteral>(c->value), e);
+        if (auto* s = dynamic_cast<const StringLiteral*>(&e))
+            return with_meta(std::make_unique<StringLiteral>(s->value), e);
+
+        if (auto* v = dynamic_cast<const VarExpr*>(&e)) {
+            const int p = b.param_index(v->name);
+            if (p < 0) {
+                if (!b.method) return nullptr;
+                return inline_node(std::make_unique<interp::InlineFieldLoad>(v->name), e);
+            }
+            if (!(*b.params)[p].type.is_ref)
+                return inline_node(std::make_unique<interp::InlineParam>(b.slot[p]), e);
+            // Referenzparameter: Variable des Aufrufers
+            const auto& arg = static_cast<const VarExpr&>(*(*b.args)[p]);
+            return with_meta(std::make_unique<VarExpr>(arg.name), e);
+        }
+
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) {
+            auto n = with_meta(std::make_unique<UnaryExpr>(), e);
+            n->op = u->op;
+            n->expr = clone(*u->expr, b);
+            return n->expr ? std::move(n) : nullptr;
+        }
+
+        if (auto* bin = dynamic_cast<const BinaryExpr*>(&e)) {
+            if (bin->op == BinaryExpr::Op::Div || bin->op == BinaryExpr::Op::Mod) return nullptr;
+            auto n = with_meta(std::make_unique<BinaryExpr>(), e);
+            n->op = bin->op;
+            n->left = clone(*bin->left, b);
+            n->right = n->left ? clone(*bin->right, b) : nullptr;
+            return n->right ? std::move(n) : nullptr;
+        }
+
+        if (auto* a = dynamic_cast<const AssignExpr*>(&e)) {
+            if (!is_primitive(a->static_type)) return nullptr;
+            const int p = b.param_index(a->name);
+            ExprPtr value = clone(*a->value, b);
+            if (!value) return nullptr;
+            if (p < 0) {
+                if (!b.method) return nullptr;
+                auto n = inline_node(std::make_unique<interp::InlineFieldStore>(a->name), e);
+                n->value = std::move(value);
+                return n;
+            }
+            if (!(*b.params)[p].type.is_ref) return nullptr; // Wertparameter bleiben unverändert
+            auto n = with_meta(std::make_unique<AssignExpr>(), e);
+            n->name = static_cast<const VarExpr&>(*(*b.args)[p]).name;
+            n->value = std::move(value);
+            return n;
+        }
+
+        if (auto* m = dynamic_cast<const MemberAccessExpr*>(&e)) {
+            auto n = with_meta(std::make_unique<MemberAccessExpr>(), e);
+            n->field = m->field;
+            n->object = clone(*m->object, b);
+            return n->object ? std::move(n) : nullptr;
+        }
+
+        if (auto* fa = dynamic_cast<const FieldAssignExpr*>(&e)) {
+            if (!is_primitive(fa->static_type)) return nullptr;
+            auto n = with_meta(std::make_unique<FieldAssignExpr>(), e);
+            n->field = fa->field;
+            n->object = clone(*fa->object, b);
+            n->value = n->object ? clone(*fa->value, b) : nullptr;
+            return n->value ? std::move(n) : nullptr;
+        }
+
+        // Aufrufe, Konstruktion: nicht inline
+        return nullptr;
+    }
+};
+
+// Ersetzt kleine Aufrufe in allen Funktions-, Methoden- und Konstruktorrümpfen;
+// max_size: höchstens so viele AST-Knoten pro Rumpf (0 = aus)
+inline void inline_calls(ast::Program& p, const interp::ClassRuntime& rt, int max_size) {
+    CallInliner(p, rt, max_size).run(p);
+}
+
+} // namespace opt
@@ -0,0 +1,392 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstddef>       // std::size_t
+#include <memory>        // std::unique_ptr
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+#include "../ast/program.hpp"          // ast::Program
+#include "../ast/class.hpp"            // ast::ClassDef, ast::MethodDef
+#include "../ast/stmt.hpp"             // Statements
+#include "../ast/expr.hpp"             // Ausdrücke
+#include "../interp/inline_nodes.hpp"  // InlinedCall, InlinedMethodCall, InlineNode
+#include "../interp/class_runtime.hpp" // ClassRuntime (Felder der Klassen)
+#include "../interp/stats.hpp"         // Zähler (--stats)
+#include "../sem/analyzer.hpp"         // sem::Analyzer::builtin_signature
+#include "walker.hpp"                  // AstWalker
+
+namespace opt {
+
+// Schleifeninvariante Ausdrücke aus while-Schleifen herausziehen:
+//   while (i < n * 2) { s = s + p.x * k; i = i + 1; }
+// wird zu
+//   { int licm$0 = n * 2; int licm$1 = p.x * k; while (i < licm$0) { s = s + licm$1; i = i + 1; } }
+// Herausgezogen werden nur typgeprüfte Ausdrücke primitiven Typs, die weder Seiteneffekte
+// haben noch fehlschlagen können (kein / oder % außer durch ein Literal ungleich 0, keine
+// Aufrufe außer Inline-Rümpfen ohne Schreibzugriffe). Sie werden vor der Schleife genau
+// einmal ausgewertet, auch wenn der Rumpf nie läuft – ohne Seiteneffekte ist das nicht
+// beobachtbar. Invariant ist ein gelesener Wert, wenn die Schleife ihn nicht ändern kann:
+// - lokale Wertvariable, die nie an eine Referenz gebunden oder als Argument übergeben wird:
+//   keine Zuweisung an den Namen in der Schleife
+// - solche Variablen mit Alias (Referenz, Argument): zusätzlich keine Aufrufe und keine
+//   Zuweisung über Referenzen
+// - Referenzen: die Schleife schreibt höchstens in lokale Wertvariablen ohne Alias
+// - Felder (obj.f, Felder des Empfängers): keine Aufrufe, keine Zuweisung über Referenzen,
+//   kein Schreiben eines Felds mit demselben Namen
+// Temporäre heißen licm$N ('$' kommt in Bezeichnern nicht vor) und liegen in einem neuen
+// Block um die Schleife. Läuft nach opt::inline_calls und vor opt::fuse_superinstructions,
+// damit Bedingungen wie i < licm$0 noch fusioniert werden.
+class LoopHoister : public AstWalker {
+public:
+    explicit LoopHoister(const interp::ClassRuntime& rt) : rt_(rt) {}
+
+protected:
+    void function(ast::FunctionDef& f) override {
+        fields_ = nullptr;
+        body(f.params, f.body);
+    }
+    void constructor(ast::ClassDef& c, ast::ConstructorDef& ctor) override {
+        fields_ = fields_of(c);
+        body(ctor.params, ctor.body);
+    }
+    void method(ast::ClassDef& c, ast::MethodDef& m) override {
+        fields_ = fields_of(c);
+        body(m.params, m.body);
+    }
+
+    void body(const std::vector<ast::Param>& params, ast::StmtPtr& body) override {
+        aliased_.clear();
+        AliasCollector(aliased_).walk(body);
+        scopes_.assign(1, {});
+        for (const auto& p : params)
+            scopes_.back()[p.name] = p.type.is_ref ? Kind::Ref : Kind::Local;
+        stmt(body);
+        scopes_.clear();
+    }
+
+    // Statements: Gültigkeitsbereiche verfolgen, Schleifen umbauen
+    void stmt(ast::StmtPtr& sp) override {
+        using namespace ast;
+        if (auto* b = dynamic_cast<BlockStmt*>(sp.get())) {
+            scopes_.emplace_back();
+            children(*b);
+            scopes_.pop_back();
+        } else if (auto* v = dynamic_cast<VarDeclStmt*>(sp.get())) {
+            scopes_.back()[v->name] = decl_kind(*v);
+        } else if (auto* w = dynamic_cast<WhileStmt*>(sp.get())) {
+            hoist(sp, *w);
+        } else {
+            children(*sp);
+        }
+    }
+
+    // Ausdrücke enthalten keine Schleifen
+    void expr(ast::ExprPtr&) override {}
+
+private:
+    using Base = ast::Type::Base;
+    using Op = ast::BinaryExpr::Op;
+    using Fields = std::unordered_map<std::string, ast::Type>;
+
+    // Art eines Namens im Rumpf
+    enum class Kind { Unknown, Local, Ref, Field };
+
+    // Schreibzugriffe einer Schleife (Bedingung + Rumpf)
+    struct Effects {
+        std::unordered_set<std::string> assigned;       // Zuweisungen x = ...
+        std::unordered_set<std::string> fields_written; // obj.f = ..., Felder des Empfängers
+        std::unordered_map<std::string, Kind> declared; // in der Schleife deklarierte Namen
+        bool calls = false;          // Aufrufe (außer Builtins und Inline-Rümpfen), Konstruktoren
+        bool ref_writes = false;     // Zuweisung über eine Referenz (oder unbekannten Namen)
+        bool aliased_writes = false; // Zuweisung an eine lokale Variable mit Alias
+    };
+
+    const interp::ClassRuntime& rt_;
+    const Fields* fields_ = nullptr;
+    std::vector<std::unordered_map<std::string, Kind>> scopes_;
+    std::unordered_set<std::string> aliased_; // an Referenzen gebunden oder als Argument übergeben
+    std::size_t next_temp_ = 0;
+
+    const Fields* fields_of(const ast::ClassDef& c) const {
+        auto it = rt_.classes.find(c.name);
+        return it != rt_.classes.end() ? &it->second.merged_fields : nullptr;
+    }
+
+    Kind kind_of(const std::string& name) const {
+        for (std::size_t i = scopes_.size(); i-- > 0;) {
+            auto it = scopes_[i].find(name);
+            if (it == scopes_[i].end()) continue;
+            // Parameter mit dem Namen eines Felds: vorsichtshalber wie ein Feld behandeln
+            if (i == 0 && fields_ && fields_->count(name)) return Kind::Field;
+            return it->second;
+        }
+        if (fields_ && fields_->count(name)) return Kind::Field;
+        return Kind::Unknown;
+    }
+
+    static Kind decl_kind(const ast::VarDeclStmt& v) {
+        return v.decl_type.is_ref ? Kind::Ref : Kind::Local;
+    }
+
+    // ---------- Schleifen umbauen ----------
+
+    void hoist(ast::StmtPtr& sp, ast::WhileStmt& w) {
+        using namespace ast;
+        Effects eff;
+        EffectCollector collect(*this, eff);
+        collect.walk(w.cond);
+        collect.walk(w.body);
+
+        std::vector<StmtPtr> temps;
+        InvariantReplacer replace(*this, eff, temps);
+        replace.walk(w.cond);
+        replace.walk(w.body);
+
+        // Schleife in einem neuen Block hinter die Temporären stellen
+        scopes_.emplace_back();
+        if (!temps.empty()) {
+            auto block = std::make_unique<BlockStmt>();
+            block->loc = w.loc;
+            for (auto& t : temps) {
+                scopes_.back()[static_cast<VarDeclStmt&>(*t).name] = Kind::Local;
+                block->statements.push_back(std::move(t));
+            }
+            block->statements.push_back(std::move(sp));
+            sp = std::move(block);
+        }
+        // Innere Schleifen (was außen invariant war, ist bereits draußen)
+        stmt(w.body);
+        scopes_.pop_back();
+    }
+
+    // ---------- Schreibzugriffe einer Schleife ----------
+
+    class EffectCollector : public AstWalker {
+    public:
+        EffectCollector(const LoopHoister& h, Effects& eff) : h_(h), eff_(eff) {}
+
+    protected:
+        void stmt(ast::StmtPtr& s) override {
+            if (auto* v = dynamic_cast<ast::VarDeclStmt*>(s.get())) {
+                Kind& k = eff_.declared[v->name];
+                if (k != Kind::Ref) k = decl_kind(*v);
+            }
+            children(*s);
+        }
+
+        void expr(ast::ExprPtr& e) override {
+            using namespace ast;
+            if (auto* a = dynamic_cast<AssignExpr*>(e.get())) {
+                h_.assignment(a->name, eff_);
+            } else if (auto* fa = dynamic_cast<FieldAssignExpr*>(e.get())) {
+                eff_.fields_written.insert(fa->field);
+            } else if (auto* st = dynamic_cast<interp::InlineFieldStore*>(e.get())) {
+                eff_.fields_written.insert(st->field);
+                expr(st->value);
+            } else if (e->specialised == Expr::Specialised::InlinedCall) {
+                inline_effects(static_cast<interp::InlinedCall&>(*e).body);
+            } else if (auto* c = dynamic_cast<CallExpr*>(e.get())) {
+                sem::FuncSymbol builtin;
+                if (!sem::Analyzer::builtin_signature(c->callee, builtin)) eff_.calls = true;
+            } else if (dynamic_cast<ConstructExpr*>(e.get())) {
+                eff_.calls = true;
+            } else if (e->specialised == Expr::Specialised::InlinedMethod) {
+                inline_effects(static_cast<interp::InlinedMethodCall&>(*e).body);
+            } else if (dynamic_cast<MethodCallExpr*>(e.get())) {
+                eff_.calls = true;
+            }
+            children(*e);
+        }
+
+    private:
+        const LoopHoister& h_;
+        Effects& eff_;
+
+        // Inline-Rümpfe schreiben nur Felder des Empfängers und ersetzte Referenzparameter
+        void inline_effects(interp::InlineBody& body) {
+            for (auto& e : body.effects) expr(e);
+            if (body.result) expr(body.result);
+        }
+    };
+
+    void assignment(const std::string& name, Effects& eff) const {
+        eff.assigned.insert(name);
+        auto it = eff.declared.find(name);
+        const Kind k = it != eff.declared.end() ? it->second : kind_of(name);
+        switch (k) {
+            case Kind::Local:
+                if (aliased_.count(name)) eff.aliased_writes = true;
+                break;
+            case Kind::Field:
+                eff.fields_written.insert(name);
+                break;
+            default:
+                eff.ref_writes = true;
+                break;
+        }
+    }
+
+    // ---------- Invarianz ----------
+
+    bool var_invariant(const std::string& name, const Effects& eff) const {
+        if (eff.declared.count(name) || eff.assigned.count(name)) return false;
+        switch (kind_of(name)) {
+            case Kind::Local:
+                return !aliased_.count(name) || (!eff.calls && !eff.ref_writes);
+            case Kind::Ref:
+                return !eff.calls && !eff.ref_writes && !eff.aliased_writes && eff.fields_written.empty();
+            case Kind::Field:
+                return field_invariant(name, eff);
+            default:
+                return false;
+        }
+    }
+
+    static bool field_invariant(const std::string& field, const Effects& eff) {
+        return !eff.calls && !eff.ref_writes && !eff.fields_written.count(field);
+    }
+
+    // Ausdruck ohne Seiteneffekte, der nicht fehlschlagen kann und in der Schleife konstant ist
+    bool invariant(const ast::Expr& e, const Effects& eff) const {
+        using namespace ast;
+        if (dynamic_cast<const IntLiteral*>(&e) || dynamic_cast<const BoolLiteral*>(&e) ||
+            dynamic_cast<const CharLiteral*>(&e) || dynamic_cast<const StringLiteral*>(&e))
+            return true;
+        if (auto* v = dynamic_cast<const VarExpr*>(&e)) return var_invariant(v->name, eff);
+        if (auto* u = dynamic_cast<const UnaryExpr*>(&e)) return invariant(*u->expr, eff);
+        if (auto* b = dynamic_cast<const BinaryExpr*>(&e)) {
+            if (b->op == Op::Div || b->op == Op::Mod) {
+                auto* d = dynamic_cast<const IntLiteral*>(b->right.get());
+                if (!d || d->value == 0) return false;
+            }
+            return invariant(*b->left, eff) && invariant(*b->right, eff);
+        }
+        if (auto* m = dynamic_cast<const MemberAccessExpr*>(&e))
+            return invariant(*m->object, eff) && field_invariant(m->field, eff);
+        // Nur innerhalb eines Inline-Rumpfs (Argumente sind dort bereits geprüft)
+        if (dynamic_cast<const interp::InlineParam*>(&e)) return true;
+        if (auto* l = dynamic_cast<const interp::InlineFieldLoad*>(&e)) return field_invariant(l->field, eff);
+        if (e.specialised == Expr::Specialised::InlinedCall) {
+            auto& c = static_cast<const interp::InlinedCall&>(e);
+            return args_invariant(c.args, eff) && body_invariant(c.body, eff);
+        }
+        if (e.specialised == Expr::Specialised::InlinedMethod) {
+            auto& mc = static_cast<const interp::InlinedMethodCall&>(e);
+            return invariant(*mc.object, eff) && args_invariant(mc.args, eff) && body_invariant(mc.body, eff);
+        }
+        return false;
+    }
+
+    bool args_invariant(const std::vector<ast::ExprPtr>& args, const Effects& eff) const {
+        for (const auto& a : args)
+            if (!invariant(*a, eff)) return false;
+        return true;
+    }
+
+    // Getter-artiger Rumpf: keine Schreibzugriffe, Ergebnis invariant
+    bool body_invariant(const interp::InlineBody& body, const Effects& eff) const {
+        return body.effects.empty() && body.result && invariant(*body.result, eff);
+    }
+
+    // ---------- Ersetzen ----------
+
+    static bool is_primitive(const ast::Type& t) {
+        return !t.is_ref && (t.base == Base::Int || t.base == Base::Bool ||
+                             t.base == Base::Char || t.base == Base::String);
+    }
+
+    // Lohnt das Herausziehen? (einzelne Variablen und Literale nicht)
+    static bool worth_hoisting(const ast::Expr& e) {
+        using namespace ast;
+        if (!e.typed || !is_primitive(e.static_type)) return false;
+        if (e.specialised == Expr::Specialised::InlinedCall ||
+            e.specialised == Expr::Specialised::InlinedMethod)
+            return true;
+        if (e.specialised != Expr::Specialised::No) return false;
+        return dynamic_cast<const UnaryExpr*>(&e) || dynamic_cast<const BinaryExpr*>(&e) ||
+               dynamic_cast<const MemberAccessExpr*>(&e);
+    }
+
+    // Ersetzt maximale invariante Teilausdrücke durch Temporäre
+    class InvariantReplacer : public AstWalker {
+    public:
+        InvariantReplacer(LoopHoister& h, const Effects& eff, std::vector<ast::StmtPtr>& temps)
+            : h_(h), eff_(eff), temps_(temps) {}
+
+    protected:
+        // Initialisierer einer Referenz: LValue-Position
+        void stmt(ast::StmtPtr& s) override {
+            auto* v = dynamic_cast<ast::VarDeclStmt*>(s.get());
+            if (v && v->init && v->decl_type.is_ref) children(*v->init);
+            else children(*s);
+        }
+
+        void expr(ast::ExprPtr& e) override {
+            if (worth_hoisting(*e) && h_.invariant(*e, eff_)) h_.replace(e, temps_);
+            else children(*e);
+        }
+
+        // Empfänger und Argumente können als LValue gebunden werden: nur Teilausdrücke ersetzen
+        void receiver(ast::ExprPtr& e) override { children(*e); }
+        void argument(ast::ExprPtr& e) override { children(*e); }
+
+    private:
+        LoopHoister& h_;
+        const Effects& eff_;
+        std::vector<ast::StmtPtr>& temps_;
+    };
+
+    void replace(ast::ExprPtr& e, std::vector<ast::StmtPtr>& temps) {
+        using namespace ast;
+        auto decl = std::make_unique<VarDeclStmt>();
+        decl->loc = e->loc;
+        decl->decl_type = e->static_type;
+        decl->name = "licm$" + std::to_string(next_temp_++);
+
+        auto var = std::make_unique<VarExpr>(decl->name);
+        var->loc = e->loc;
+        var->static_type = e->static_type;
+        var->typed = true;
+
+        decl->init = std::move(e);
+        e = std::move(var);
+        temps.push_back(std::move(decl));
+        ++interp::stats().hoisted_exprs;
+    }
+
+    // ---------- Aliase: Variablen, die an Referenzen gebunden werden können ----------
+
+    class AliasCollector : public AstWalker {
+    public:
+        explicit AliasCollector(std::unordered_set<std::string>& aliased) : aliased_(aliased) {}
+
+    protected:
+        void stmt(ast::StmtPtr& s) override {
+            auto* v = dynamic_cast<ast::VarDeclStmt*>(s.get());
+            if (v && v->init && v->decl_type.is_ref) alias(*v->init);
+            children(*s);
+        }
+
+        void argument(ast::ExprPtr& e) override {
+            alias(*e);
+            expr(e);
+        }
+
+    private:
+        std::unordered_set<std::string>& aliased_;
+
+        void alias(const ast::Expr& e) {
+            if (auto* v = dynamic_cast<const ast::VarExpr*>(&e)) aliased_.insert(v->name);
+        }
+    };
+};
+
+// Zieht schleifeninvariante Ausdrücke aller Funktions-, Methoden- und Konstruktorrümpfe heraus
+inline void hoist_loop_invariants(ast::Program& p, const interp::ClassRuntime& rt) {
+    LoopHoister(rt).run(p);
+}
+
+} // namespace opt
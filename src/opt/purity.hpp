@@ -0,0 +1,158 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+#include "../ast/program.hpp"   // ast::Program
+#include "../ast/function.hpp"  // ast::FunctionDef
+#include "../ast/stmt.hpp"      // Statements
+#include "../ast/expr.hpp"      // Ausdrücke
+#include "../sem/analyzer.hpp"  // sem::Analyzer::builtin_signature
+#include "walker.hpp"           // AstWalker
+
+namespace opt {
+
+// Erkennt reine freie Funktionen: das Ergebnis hängt nur von den Argumenten ab, und der
+// Aufruf hat keine beobachtbaren Wirkungen außer seinem Ergebnis (bzw. einem Fehler).
+// Rein ist eine Funktion, wenn
+// - Parameter und Rückgabetyp primitiv sind (keine Referenzen, keine Objekte, nicht void),
+// - der Rumpf nur eigene Parameter und lokale primitive Variablen liest und schreibt
+//   (Funktionsframes hängen am Env des Aufrufers: ein fremder Name wäre dessen Variable),
+// - keine Builtins (Ein-/Ausgabe), Objekte, Felder oder Methoden vorkommen und
+// - alle Aufrufe Funktionen treffen, deren Overloads sämtlich rein sind.
+// Rekursion ist erlaubt: ausgehend von allen Kandidaten wird entfernt, wer eine unreine
+// Funktion aufruft, bis sich nichts mehr ändert. recursive() meldet reine Funktionen auf
+// einem Aufrufzyklus (nur dort muss jeder Aufruf am Cache vorbei).
+class PurityAnalysis : public AstWalker {
+public:
+    std::unordered_set<const ast::FunctionDef*> run(ast::Program& p) {
+        std::unordered_map<std::string, std::vector<const ast::FunctionDef*>> overloads;
+        for (const auto& f : p.functions) overloads[f.name].push_back(&f);
+
+        // 1) lokal reine Kandidaten und ihre Aufrufziele (Namen)
+        std::unordered_map<const ast::FunctionDef*, std::unordered_set<std::string>> calls;
+        for (auto& f : p.functions) {
+            callees_.clear();
+            if (candidate(f)) calls.emplace(&f, std::move(callees_));
+        }
+
+        // 2) Wer Unreines (oder Unbekanntes) aufruft, ist selbst unrein
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (auto it = calls.begin(); it != calls.end();) {
+                bool pure = true;
+                for (const auto& name : it->second) {
+                    auto o = overloads.find(name);
+                    if (o == overloads.end()) { pure = false; break; }
+                    for (const ast::FunctionDef* g : o->second)
+                        if (!calls.count(g)) { pure = false; break; }
+                    if (!pure) break;
+                }
+                if (pure) { ++it; continue; }
+                it = calls.erase(it);
+                changed = true;
+            }
+        }
+
+        // 3) Reine Funktionen auf einem Aufrufzyklus (Ziele sind sämtlich rein)
+        recursive_.clear();
+        for (const auto& kv : calls) {
+            std::unordered_set<const ast::FunctionDef*> seen;
+            std::vector<const ast::FunctionDef*> work{kv.first};
+            while (!work.empty() && !recursive_.count(kv.first)) {
+                const ast::FunctionDef* f = work.back();
+                work.pop_back();
+                for (const auto& name : calls.at(f))
+                    for (const ast::FunctionDef* g : overloads.at(name)) {
+                        if (g == kv.first) recursive_.insert(kv.first);
+                        if (seen.insert(g).second) work.push_back(g);
+                    }
+            }
+        }
+
+        std::unordered_set<const ast::FunctionDef*> result;
+        for (const auto& kv : calls) result.insert(kv.first);
+        return result;
+    }
+
+    // true, wenn f (nach run) direkt oder über andere Funktionen sich selbst aufruft
+    bool recursive(const ast::FunctionDef& f) const { return recursive_.count(&f) != 0; }
+
+protected:
+    // Nur Blöcke, Deklarationen primitiver Variablen und die übrigen Statements
+    void stmt(ast::StmtPtr& s) override {
+        using namespace ast;
+        if (!pure_) return;
+        if (auto* b = dynamic_cast<BlockStmt*>(s.get())) {
+            scopes_.emplace_back();
+            children(*b);
+            scopes_.pop_back();
+        } else if (auto* v = dynamic_cast<VarDeclStmt*>(s.get())) {
+            if (!primitive(v->decl_type)) { pure_ = false; return; }
+            children(*v);
+            scopes_.back().insert(v->name); // erst nach dem Initialisierer sichtbar
+        } else {
+            children(*s);
+        }
+    }
+
+    // Literale, eigene Variablen, Operatoren und Aufrufe von Skript-Funktionen;
+    // alles andere (Builtins, Objekte, Felder, Methoden) ist unrein
+    void expr(ast::ExprPtr& e) override {
+        using namespace ast;
+        if (!pure_) return;
+        if (dynamic_cast<const IntLiteral*>(e.get()) || dynamic_cast<const BoolLiteral*>(e.get()) ||
+            dynamic_cast<const CharLiteral*>(e.get()) || dynamic_cast<const StringLiteral*>(e.get()))
+            return;
+        if (auto* v = dynamic_cast<const VarExpr*>(e.get())) {
+            pure_ = local(v->name);
+        } else if (auto* a = dynamic_cast<AssignExpr*>(e.get())) {
+            pure_ = local(a->name);
+            children(*a);
+        } else if (dynamic_cast<const UnaryExpr*>(e.get()) || dynamic_cast<const BinaryExpr*>(e.get())) {
+            children(*e);
+        } else if (auto* c = dynamic_cast<CallExpr*>(e.get())) {
+            sem::FuncSymbol builtin;
+            if (sem::Analyzer::builtin_signature(c->callee, builtin)) { pure_ = false; return; }
+            children(*c);
+            callees_.insert(c->callee);
+        } else {
+            pure_ = false;
+        }
+    }
+
+private:
+    std::vector<std::unordered_set<std::string>> scopes_;
+    std::unordered_set<const ast::FunctionDef*> recursive_;
+    std::unordered_set<std::string> callees_;
+    bool pure_ = true; // aktueller Kandidat bisher rein
+
+    static bool primitive(const ast::Type& t) {
+        using Base = ast::Type::Base;
+        return !t.is_ref && (t.base == Base::Int || t.base == Base::Bool ||
+                             t.base == Base::Char || t.base == Base::String);
+    }
+
+    bool candidate(ast::FunctionDef& f) {
+        if (!f.body || !primitive(f.return_type)) return false;
+        scopes_.assign(1, {});
+        for (const auto& p : f.params) {
+            if (!primitive(p.type)) return false;
+            scopes_.back().insert(p.name);
+        }
+        pure_ = true;
+        stmt(f.body);
+        return pure_;
+    }
+
+    bool local(const std::string& name) const {
+        for (const auto& s : scopes_)
+            if (s.count(name)) return true;
+        return false;
+    }
+};
+
+} // namespace opt
@@ -0,0 +1,91 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <memory>   // std::unique_ptr
+#include <string>   // std::string
+#include <type_traits> // std::is_same_v
+
+#include "../ast/program.hpp"          // ast::Program
+#include "../ast/stmt.hpp"             // Statements
+#include "../ast/expr.hpp"             // Ausdrücke
+#include "../interp/binary_nodes.hpp"  // ArithNode, CmpNode
+#include "../interp/stats.hpp"         // Zähler (--stats)
+#include "walker.hpp"                  // AstWalker
+
+namespace opt {
+
+// Ersetzt typgeprüfte BinaryExpr (Arithmetik, Vergleiche) durch spezialisierte Knoten.
+// Setzt die statischen Typen der semantischen Analyse voraus; && und || bleiben unverändert.
+class BinarySpecialiser : public AstWalker {
+protected:
+    // Kinder zuerst, danach ggf. den Knoten selbst ersetzen
+    void expr(ast::ExprPtr& e) override {
+        children(*e);
+        if (auto* b = dynamic_cast<ast::BinaryExpr*>(e.get())) specialise(e, *b);
+    }
+
+private:
+    using Base = ast::Type::Base;
+    using Op = ast::BinaryExpr::Op;
+
+    void specialise(ast::ExprPtr& e, ast::BinaryExpr& b) {
+        if (b.specialised != ast::Expr::Specialised::No || !b.typed || !b.left->typed || !b.right->typed) return;
+
+        std::unique_ptr<interp::SpecialisedBinary> node;
+        switch (b.left->static_type.base) {
+            case Base::Int:    node = for_type<int>(b.op); break;
+            case Base::Char:   node = for_type<char>(b.op); break;
+            case Base::Bool:   node = for_type<bool>(b.op); break;
+            case Base::String: node = for_type<std::string>(b.op); break;
+            default: break;
+        }
+        if (!node) return;
+
+        node->loc = b.loc;
+        node->static_type = b.static_type;
+        node->typed = true;
+        node->specialised = ast::Expr::Specialised::Binary;
+        node->op = b.op;
+        node->left = std::move(b.left);
+        node->right = std::move(b.right);
+        e = std::move(node);
+        ++interp::stats().specialised_ops;
+    }
+
+    // Arithmetik nur fuer int, <, <=, >, >= fuer int/char, == / != fuer alle primitiven Typen
+    template <class T>
+    static std::unique_ptr<interp::SpecialisedBinary> for_type(Op op) {
+        using namespace interp;
+        if constexpr (std::is_same_v<T, int>) {
+            switch (op) {
+                case Op::Add: return std::make_unique<ArithNode<AddOp>>();
+                case Op::Sub: return std::make_unique<ArithNode<SubOp>>();
+                case Op::Mul: return std::make_unique<ArithNode<MulOp>>();
+                case Op::Div: return std::make_unique<ArithNode<DivOp>>();
+                case Op::Mod: return std::make_unique<ArithNode<ModOp>>();
+                default: break;
+            }
+        }
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, char>) {
+            switch (op) {
+                case Op::Lt: return std::make_unique<CmpNode<Lt, T>>();
+                case Op::Le: return std::make_unique<CmpNode<Le, T>>();
+                case Op::Gt: return std::make_unique<CmpNode<Gt, T>>();
+                case Op::Ge: return std::make_unique<CmpNode<Ge, T>>();
+                default: break;
+            }
+        }
+        switch (op) {
+            case Op::Eq: return std::make_unique<EqNode<T>>();
+            case Op::Ne: return std::make_unique<CmpNode<Ne, T>>();
+            default:     return nullptr;
+        }
+    }
+};
+
+// Spezialisiert alle Funktions-, Methoden- und Konstruktorrümpfe eines Programms
+inline void specialise_binaries(ast::Program& p) {
+    BinarySpecialiser().run(p);
+}
+
+} // namespace opt
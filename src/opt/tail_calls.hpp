@@ -0,0 +1,36 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include "../ast/program.hpp" // ast::Program
+#include "../ast/stmt.hpp"    // Statements
+#include "../ast/expr.hpp"    // CallExpr, MethodCallExpr
+#include "walker.hpp"         // AstWalker
+
+namespace opt {
+
+// Statische Erkennung von Tail-Calls:
+// "return f(args);" und "return obj.m(args);" werden als ReturnStmt::tail_call markiert.
+// Ob der Frame tatsächlich wiederverwendet werden kann (gleicher Rückgabetyp, keine
+// Referenzargumente in den Frame), entscheidet der Interpreter zur Laufzeit.
+// Konstruktoren enthalten nur return; ohne Wert und bleiben damit unmarkiert.
+class TailCallMarker : public AstWalker {
+protected:
+    void stmt(ast::StmtPtr& s) override {
+        if (auto* r = dynamic_cast<ast::ReturnStmt*>(s.get())) {
+            r->tail_call = r->value && (dynamic_cast<const ast::CallExpr*>(r->value.get()) ||
+                                        dynamic_cast<const ast::MethodCallExpr*>(r->value.get()));
+            return;
+        }
+        children(*s);
+    }
+
+    // Tail-Positionen liegen nur in Statements
+    void expr(ast::ExprPtr&) override {}
+};
+
+// Markiert alle Funktions-, Methoden- und Konstruktorrümpfe eines Programms
+inline void mark_tail_calls(ast::Program& p) {
+    TailCallMarker().run(p);
+}
+
+} // namespace opt
@@ -0,0 +1,99 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <vector>   // std::vector
+
+#include "../ast/program.hpp"  // ast::Program
+#include "../ast/function.hpp" // ast::FunctionDef, ast::Param
+#include "../ast/class.hpp"    // ast::ClassDef, ast::MethodDef, ast::ConstructorDef
+#include "../ast/stmt.hpp"     // Statements
+#include "../ast/expr.hpp"     // Ausdrücke
+
+namespace opt {
+
+// Gemeinsamer Durchlauf über den AST aller Rümpfe eines Programms (Analysen und
+// Umbauten in opt/ sowie sem::clear_static_types).
+// Ein Durchlauf überschreibt stmt()/expr() für die Knoten, die ihn interessieren, und ruft
+// für alle übrigen children() auf. Knoten werden als Eigentumszeiger übergeben, damit ein
+// Durchlauf sie ersetzen kann. Kinder werden in Auswertungsreihenfolge besucht; Empfänger
+// (obj.f, obj.m(...)) und Argumente laufen zusätzlich über receiver() bzw. argument(),
+// dort kann ein LValue gebunden werden bzw. ein Objekt ohne Kopie weitergegeben werden.
+// Ausführungsknoten des Interpreters (Inline-Rümpfe) haben keine Kinder für den Walker.
+class AstWalker {
+public:
+    virtual ~AstWalker() = default;
+
+    // Alle Rümpfe: freie Funktionen, dann je Klasse Konstruktoren und Methoden
+    void run(ast::Program& p) {
+        for (auto& f : p.functions)
+            if (f.body) function(f);
+        for (auto& c : p.classes) {
+            for (auto& ctor : c.ctors)
+                if (ctor.body) constructor(c, ctor);
+            for (auto& m : c.methods)
+                if (m.body) method(c, m);
+        }
+    }
+
+    // Einzelner Teilbaum (z.B. Bedingung und Rumpf einer Schleife)
+    void walk(ast::StmtPtr& s) { stmt(s); }
+    void walk(ast::ExprPtr& e) { expr(e); }
+
+protected:
+    // Einstieg pro Rumpf (Default: body)
+    virtual void function(ast::FunctionDef& f) { body(f.params, f.body); }
+    virtual void constructor(ast::ClassDef&, ast::ConstructorDef& c) { body(c.params, c.body); }
+    virtual void method(ast::ClassDef&, ast::MethodDef& m) { body(m.params, m.body); }
+    virtual void body(const std::vector<ast::Param>&, ast::StmtPtr& b) { stmt(b); }
+
+    virtual void stmt(ast::StmtPtr& s) { children(*s); }
+    virtual void expr(ast::ExprPtr& e) { children(*e); }
+    virtual void receiver(ast::ExprPtr& e) { expr(e); }
+    virtual void argument(ast::ExprPtr& e) { expr(e); }
+
+    void children(ast::Stmt& s) {
+        using namespace ast;
+        if (auto* b = dynamic_cast<BlockStmt*>(&s)) {
+            for (auto& st : b->statements) stmt(st);
+        } else if (auto* v = dynamic_cast<VarDeclStmt*>(&s)) {
+            if (v->init) expr(v->init);
+        } else if (auto* e = dynamic_cast<ExprStmt*>(&s)) {
+            expr(e->expr);
+        } else if (auto* i = dynamic_cast<IfStmt*>(&s)) {
+            expr(i->cond);
+            stmt(i->then_branch);
+            if (i->else_branch) stmt(i->else_branch);
+        } else if (auto* w = dynamic_cast<WhileStmt*>(&s)) {
+            expr(w->cond);
+            stmt(w->body);
+        } else if (auto* r = dynamic_cast<ReturnStmt*>(&s)) {
+            if (r->value) expr(r->value);
+        }
+    }
+
+    void children(ast::Expr& e) {
+        using namespace ast;
+        if (auto* u = dynamic_cast<UnaryExpr*>(&e)) {
+            expr(u->expr);
+        } else if (auto* b = dynamic_cast<BinaryExpr*>(&e)) {
+            expr(b->left);
+            expr(b->right);
+        } else if (auto* a = dynamic_cast<AssignExpr*>(&e)) {
+            expr(a->value);
+        } else if (auto* fa = dynamic_cast<FieldAssignExpr*>(&e)) {
+            receiver(fa->object);
+            expr(fa->value);
+        } else if (auto* m = dynamic_cast<MemberAccessExpr*>(&e)) {
+            receiver(m->object);
+        } else if (auto* c = dynamic_cast<CallExpr*>(&e)) {
+            for (auto& arg : c->args) argument(arg);
+        } else if (auto* ce = dynamic_cast<ConstructExpr*>(&e)) {
+            for (auto& arg : ce->args) argument(arg);
+        } else if (auto* mc = dynamic_cast<MethodCallExpr*>(&e)) {
+            receiver(mc->object);
+            for (auto& arg : mc->args) argument(arg);
+        }
+    }
+};
+
+} // namespace opt
@@ -32,9 +32,11 @@ class Parser {
 public:
     // tokens: bereits geläxte Tokens
     // class_names: optionale Menge bekannter Klassennamen (wichtig fuer "Type vs. Identifier")
+    // known_classes: weitere bekannte Klassen, nicht kopiert (muss den Parser überleben)
     explicit Parser(std::vector<lexer::Token> toks,
-                    std::unordered_set<std::string> class_names = {})
-        : tokens_(std::move(toks)), class_names_(std::move(class_names)) {}
+                    std::unordered_set<std::string> class_names = {},
+                    const std::unordered_set<std::string>* known_classes = nullptr)
+        : tokens_(std::move(toks)), class_names_(std::move(class_names)), known_classes_(known_classes) {}
 
     // Parst ein komplettes Programm: Abfolge aus class-defs und function-defs
     ast::Program parse_program() {
@@ -50,20 +52,28 @@ public:
     }
 
     // Convenience: Lexer + Prescan + Parser in einem Schritt
-    static ast::Program parse_source(std::string_view src) {
+    // known_classes: bereits bekannte Klassen (z.B. aus frueheren REPL-Eingaben)
+    static ast::Program parse_source(std::string_view src,
+                                     const std::unordered_set<std::string>& known_classes = {}) {
         lexer::Lexer lx(src);
         auto toks = lx.tokenize();
         auto cn = prescan_class_names(toks);   // Klassennamen vorab einsammeln
-        Parser ps(std::move(toks), std::move(cn));
+        Parser ps(std::move(toks), std::move(cn), &known_classes);
         return ps.parse_program();
     }
 
 private:
     std::vector<lexer::Token> tokens_;          // Tokenstream
     std::unordered_set<std::string> class_names_; // bekannte Klassen (fuer Typ-Erkennung)
+    const std::unordered_set<std::string>* known_classes_ = nullptr; // Klassen früherer Eingaben
     size_t i_ = 0;                              // aktueller Tokenindex
 
 private:
+    // true, wenn name ein Klassenname ist (aus dieser Eingabe oder schon bekannt)
+    bool is_class_name(const std::string& name) const {
+        return class_names_.count(name) || (known_classes_ && known_classes_->count(name));
+    }
+
     // Prescan: sammelt alle Klassennamen, damit parse_stmt "T x;" vs. "x();" unterscheiden kann
     static std::unordered_set<std::string> prescan_class_names(const std::vector<lexer::Token>& toks) {
         std::unordered_set<std::string> cn;
@@ -103,6 +113,18 @@ private:
         }
     }
 
+    // Position des aktuellen Tokens
+    ast::SourceLoc loc_here() const {
+        const auto& t = peek();
+        return ast::SourceLoc{t.line, t.col};
+    }
+
+    // Position des zuletzt konsumierten Tokens (z.B. eines Operators)
+    ast::SourceLoc loc_prev() const {
+        const auto& t = tokens_[i_ > 0 ? i_ - 1 : 0];
+        return ast::SourceLoc{t.line, t.col};
+    }
+
     // Prüft Lookahead auf Lexem
     bool peek_lex(std::string_view lx) const { return !is_end() && peek().lexeme == lx; }
 
@@ -227,6 +249,7 @@ private:
     ast::FunctionDef parse_function_def() {
         ast::FunctionDef f;
         f.return_type = parse_type();
+        f.loc = loc_here();
         f.name = take_ident("expected function name");
         expect_lex("(", "expected '(' after function name");
         f.params = parse_param_list();
@@ -238,6 +261,7 @@ private:
     ast::ClassDef parse_class_def() {
         expect_lex("class", "expected 'class'");
         ast::ClassDef c;
+        c.loc = loc_here();
         c.name = take_ident("expected class name");
 
         // Optional: ": public Base"
@@ -264,9 +288,10 @@ private:
 
             // Konstruktor: ClassName(...)
             if (peek_is_ident() && peek().lexeme == c.name && peek(1).lexeme == "(") {
+                ast::ConstructorDef ctor;
+                ctor.loc = loc_here();
                 (void)take_ident("expected ctor name");
                 expect_lex("(", "expected '(' after ctor name");
-                ast::ConstructorDef ctor;
                 ctor.params = parse_param_list();
                 ctor.body = parse_block_stmt();
                 c.ctors.push_back(std::move(ctor));
@@ -275,6 +300,7 @@ private:
 
             // Sonst: Feld oder Methode (Type member_name ... )
             ast::Type t = parse_type();
+            ast::SourceLoc member_loc = loc_here();
             std::string member_name = take_ident("expected member name");
 
             // Methode: Type name(...)
@@ -283,6 +309,7 @@ private:
                 m.is_virtual = is_virtual;
                 m.return_type = t;
                 m.name = member_name;
+                m.loc = member_loc;
                 m.params = parse_param_list();
                 m.body = parse_block_stmt();
                 c.methods.push_back(std::move(m));
@@ -291,6 +318,7 @@ private:
                 ast::FieldDecl fld;
                 fld.type = t;
                 fld.name = member_name;
+                fld.loc = member_loc;
 
                 // Optionaler Feld-Initializer wird nur konsumiert (AST ignoriert ihn aktuell)
                 if (match_lex("=")) {
@@ -309,8 +337,16 @@ private:
 
     // ---------- statements ----------
 
-    // Parst ein einzelnes Statement
+    // Parst ein einzelnes Statement und vermerkt dessen Startposition
     ast::StmtPtr parse_stmt() {
+        ast::SourceLoc at = loc_here();
+        ast::StmtPtr s = parse_stmt_at();
+        s->loc = at;
+        return s;
+    }
+
+    // Parst ein einzelnes Statement (ohne Positionsangabe)
+    ast::StmtPtr parse_stmt_at() {
         // Block
         if (peek_lex("{")) return parse_block_stmt();
 
@@ -351,7 +387,7 @@ private:
         // - primitive types
         // - oder Identifier, der als Klassenname bekannt ist
         if (peek_lex("int") || peek_lex("bool") || peek_lex("char") || peek_lex("string") || peek_lex("void") ||
-            (peek_is_ident() && class_names_.count(peek().lexeme))) {
+            (peek_is_ident() && is_class_name(peek().lexeme))) {
 
             ast::Type t = parse_type();
             std::string name = take_ident("expected variable name");
@@ -376,8 +412,9 @@ private:
 
     // Parst einen Block: { stmt* }
     std::unique_ptr<ast::BlockStmt> parse_block_stmt() {
-        expect_lex("{", "expected '{' to start block");
         auto b = std::make_unique<ast::BlockStmt>();
+        b->loc = loc_here();
+        expect_lex("{", "expected '{' to start block");
         while (!match_lex("}")) {
             if (is_end()) throw err_here("unexpected end in block");
             b->statements.push_back(parse_stmt());
@@ -395,11 +432,13 @@ private:
         auto e = parse_logical_or();
 
         if (match_lex("=")) {
+            ast::SourceLoc at = loc_prev();
             auto rhs = parse_assignment();
 
             // var = expr
             if (auto* ve = dynamic_cast<ast::VarExpr*>(e.get())) {
                 auto a = std::make_unique<ast::AssignExpr>();
+                a->loc = at;
                 a->name = ve->name;
                 a->value = std::move(rhs);
                 return a;
@@ -408,6 +447,7 @@ private:
             // obj.f = expr
             if (auto* me = dynamic_cast<ast::MemberAccessExpr*>(e.get())) {
                 auto fa = std::make_unique<ast::FieldAssignExpr>();
+                fa->loc = at;
                 fa->object = std::move(me->object);
                 fa->field = me->field;
                 fa->value = std::move(rhs);
@@ -425,6 +465,7 @@ private:
         auto e = parse_logical_and();
         while (match_lex("||")) {
             auto b = std::make_unique<ast::BinaryExpr>();
+            b->loc = loc_prev();
             b->op = ast::BinaryExpr::Op::OrOr;
             b->left = std::move(e);
             b->right = parse_logical_and();
@@ -438,6 +479,7 @@ private:
         auto e = parse_equality();
         while (match_lex("&&")) {
             auto b = std::make_unique<ast::BinaryExpr>();
+            b->loc = loc_prev();
             b->op = ast::BinaryExpr::Op::AndAnd;
             b->left = std::move(e);
             b->right = parse_equality();
@@ -452,12 +494,14 @@ private:
         for (;;) {
             if (match_lex("==")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Eq;
                 b->left = std::move(e);
                 b->right = parse_relational();
                 e = std::move(b);
             } else if (match_lex("!=")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Ne;
                 b->left = std::move(e);
                 b->right = parse_relational();
@@ -473,24 +517,28 @@ private:
         for (;;) {
             if (match_lex("<")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Lt;
                 b->left = std::move(e);
                 b->right = parse_additive();
                 e = std::move(b);
             } else if (match_lex("<=")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Le;
                 b->left = std::move(e);
                 b->right = parse_additive();
                 e = std::move(b);
             } else if (match_lex(">")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Gt;
                 b->left = std::move(e);
                 b->right = parse_additive();
                 e = std::move(b);
             } else if (match_lex(">=")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Ge;
                 b->left = std::move(e);
                 b->right = parse_additive();
@@ -506,12 +554,14 @@ private:
         for (;;) {
             if (match_lex("+")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Add;
                 b->left = std::move(e);
                 b->right = parse_multiplicative();
                 e = std::move(b);
             } else if (match_lex("-")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Sub;
                 b->left = std::move(e);
                 b->right = parse_multiplicative();
@@ -527,18 +577,21 @@ private:
         for (;;) {
             if (match_lex("*")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Mul;
                 b->left = std::move(e);
                 b->right = parse_unary();
                 e = std::move(b);
             } else if (match_lex("/")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Div;
                 b->left = std::move(e);
                 b->right = parse_unary();
                 e = std::move(b);
             } else if (match_lex("%")) {
                 auto b = std::make_unique<ast::BinaryExpr>();
+                b->loc = loc_prev();
                 b->op = ast::BinaryExpr::Op::Mod;
                 b->left = std::move(e);
                 b->right = parse_unary();
@@ -552,6 +605,7 @@ private:
     ast::ExprPtr parse_unary() {
         if (match_lex("!")) {
             auto u = std::make_unique<ast::UnaryExpr>();
+            u->loc = loc_prev();
             u->op = ast::UnaryExpr::Op::Not;
             u->expr = parse_unary();
             return u;
@@ -562,6 +616,7 @@ private:
         }
         if (match_lex("-")) {
             auto u = std::make_unique<ast::UnaryExpr>();
+            u->loc = loc_prev();
             u->op = ast::UnaryExpr::Op::Neg;
             u->expr = parse_unary();
             return u;
@@ -575,11 +630,13 @@ private:
 
         for (;;) {
             if (match_lex(".")) {
+                ast::SourceLoc at = loc_prev();
                 std::string field = take_ident("expected field/method name after '.'");
 
                 // MethodCall: obj.m(...)
                 if (match_lex("(")) {
                     auto mc = std::make_unique<ast::MethodCallExpr>();
+                    mc->loc = at;
                     mc->object = std::move(e);
                     mc->method = std::move(field);
 
@@ -597,6 +654,7 @@ private:
 
                 // MemberAccess: obj.f
                 auto ma = std::make_unique<ast::MemberAccessExpr>();
+                ma->loc = at;
                 ma->object = std::move(e);
                 ma->field = std::move(field);
 
@@ -612,6 +670,14 @@ private:
 
     // primary: literals | ident | call/construct | "(" expr ")"
     ast::ExprPtr parse_primary() {
+        ast::SourceLoc at = loc_here();
+        ast::ExprPtr e = parse_primary_at();
+        if (!e->loc.known()) e->loc = at;
+        return e;
+    }
+
+    // primary ohne Positionsangabe (Gruppierung behaelt die Position des Inneren)
+    ast::ExprPtr parse_primary_at() {
         // Gruppierung
         if (match_lex("(")) {
             auto e = parse_expr();
@@ -661,7 +727,7 @@ private:
                 }
 
                 // Wenn name ein Klassenname ist => Konstruktion, sonst Funktionsaufruf
-                if (class_names_.count(name)) {
+                if (is_class_name(name)) {
                     auto c = std::make_unique<ast::ConstructExpr>();
                     c->class_name = std::move(name);
                     c->args = std::move(args);
@@ -10,8 +10,12 @@
 #include "../parser/parser.hpp" // Parser::parse_source()
 
 #include "../interp/env.hpp"      // Env (Scopes/Variablen)
-#include "../interp/exec.hpp"     // exec_stmt(), eval_expr()
+#include "../interp/exec.hpp"     // exec_top_level_stmt(), eval_expr()
 #include "../interp/functions.hpp"// FunctionTable
+#include "../interp/output.hpp"   // gepufferte Programmausgabe
+#include "../interp/limits.hpp"   // Schritt-/Zeitbudget pro Eingabe
+#include "../opt/tail_calls.hpp"  // Tail-Call-Markierung neuer Definitionen
+#include "../sem/static_types.hpp" // statische Typen verwerfen, wenn Definitionen dazukommen
 
 namespace repl {
 
@@ -122,9 +126,12 @@ inline int run_repl(ast::Program& global_program,
     std::cout << "mini_cpp REPL (:q zum Beenden)\n";
 
     std::string buf;               // sammelt ggf. Multi-Line Input
+    bool static_types = true;      // global_program trägt noch statische Typen der Analyse
     int paren = 0, brace = 0, bracket = 0; // Balance-Zaehler
 
     while (true) {
+        // Gepufferte Programmausgabe vor dem Prompt rausschreiben
+        interp::output().flush();
         std::cout << (buf.empty() ? "> " : "... ") << std::flush;
 
         std::string line;
@@ -167,14 +174,42 @@ inline int run_repl(ast::Program& global_program,
 
             if (is_global_definition(src)) {
                 // Global: Klassen + Funktionen (kein Zugriff auf Session-Variablen)
-                ast::Program p = parser::Parser::parse_source(src);
-
-                // In das globale Programm "anhängen"
-                for (auto& c : p.classes)    global_program.classes.push_back(std::move(c));
-                for (auto& f : p.functions)  global_program.functions.push_back(std::move(f));
+                ast::Program p = parser::Parser::parse_source(src, functions.class_rt.class_names);
+                opt::mark_tail_calls(p);
+
+                // Neue Definitionen hat die semantische Analyse nicht gesehen:
+                // ab jetzt ohne statische Typen (dynamische Prüfungen wie bisher).
+                // Einmal genügt: spätere Eingaben werden nie analysiert.
+                if (static_types) {
+                    sem::clear_static_types(global_program);
+                    static_types = false;
+                }
 
-                // Runtime neu bauen
-                rebuild(global_program, functions);
+                // ... und können die Overload-Auflösung übersetzter Aufrufe ändern
+                jit::jit().reset();
+                closure::engine().reset();
+                interp::memo().reset(); // neue Definitionen könnten Funktionen unrein machen
+
+                // In das globale Programm "anhängen" und inkrementell registrieren
+                // (deque: bestehende Pointer in den Tabellen bleiben gültig)
+                for (auto& c : p.classes) {
+                    global_program.classes.push_back(std::move(c));
+                    try {
+                        functions.add_class(global_program.classes.back());
+                    } catch (...) {
+                        global_program.classes.pop_back();
+                        throw;
+                    }
+                }
+                for (auto& f : p.functions) {
+                    global_program.functions.push_back(std::move(f));
+                    try {
+                        functions.add(global_program.functions.back());
+                    } catch (...) {
+                        global_program.functions.pop_back();
+                        throw;
+                    }
+                }
             } else {
                 // Session: einzelne Statements/Exprs ausführen.
                 // Trick: in eine Wrapper-Funktion packen, damit Parser nur "programm" parsen muss.
@@ -182,7 +217,7 @@ inline int run_repl(ast::Program& global_program,
                 wrapped += src;
                 wrapped += "\n}\n";
 
-                ast::Program p = parser::Parser::parse_source(wrapped);
+                ast::Program p = parser::Parser::parse_source(wrapped, functions.class_rt.class_names);
                 if (p.functions.empty())
                     throw std::runtime_error("internal: REPL wrapper produced no function");
 
@@ -191,19 +226,27 @@ inline int run_repl(ast::Program& global_program,
                 if (!body)
                     throw std::runtime_error("internal: REPL wrapper body is not a block");
 
+                // Jede Eingabe bekommt ein eigenes Schritt-/Zeitbudget
+                interp::limits().restart();
+
                 // Statements aus dem Block nacheinander ausführen
                 for (const auto& st : body->statements) {
                     // ExprStmt: Wert ausgeben (REPL-typisch)
                     if (auto* es = dynamic_cast<const ast::ExprStmt*>(st.get())) {
+                        interp::current_loc() = nullptr; // Ausdruck: Fehler ohne Position
                         interp::Value v = interp::eval_expr(session_env, *es->expr, functions);
+                        interp::output().flush();
                         std::cout << interp::to_string(v) << "\n";
                     } else {
                         // "normale" Statements
-                        interp::exec_stmt(session_env, *st, functions);
+                        // "return" beendet die restliche Eingabe
+                        if (interp::exec_top_level_stmt(session_env, *st, functions) == interp::Flow::Return)
+                            break;
                     }
                 }
             }
         } catch (const std::exception& ex) {
+            interp::output().flush();
             std::cerr << "FEHLER: " << ex.what() << "\n";
         }
 
@@ -278,102 +278,135 @@ struct ClassTable {
         return out;
     }
 
-    // Overload-Resolution für Methodenaufruf am *statischen* Typ:
-    // - base type muss exakt matchen
-    // - Ref-Parameter verlangen lvalue-Args
-    // - Score: +1 pro gebundenem Ref-Param (tie-breaker)
+    // Prüft: base == derived oder derived erbt (transitiv) von base
+    bool is_base_of(const std::string& base, const std::string& derived) const {
+        return is_same_or_derived(derived, base);
+    }
+
+    // Passt eine Parameterliste exakt auf die Argumente? (Regeln wie im Interpreter)
+    // - Basistyp des Parameters muss exakt dem Argumenttyp entsprechen
+    // - Ref-Param braucht lvalue-Arg
+    static bool params_accept(const std::vector<ast::Type>& params,
+                              const std::vector<ast::Type>& arg_base_types,
+                              const std::vector<bool>& arg_is_lvalue) {
+        if (params.size() != arg_base_types.size()) return false;
+        for (size_t i = 0; i < params.size(); ++i) {
+            if (base_type(params[i]) != arg_base_types[i]) return false;
+            if (params[i].is_ref && !arg_is_lvalue[i]) return false;
+        }
+        return true;
+    }
+
+    // Overload-Resolution für Methodenaufruf am *statischen* Typ
+    // (wie interp::ClassRuntime::resolve_method):
+    // - die Kette wird ab static_class durchsucht
+    // - die erste Klasse mit genau einem passenden Overload gewinnt
+    //   (mehrdeutige Klassen werden wie zur Laufzeit übersprungen)
     const MethodSymbol& resolve_method_call(const std::string& static_class,
                                            const std::string& method,
                                            const std::vector<ast::Type>& arg_base_types,
                                            const std::vector<bool>& arg_is_lvalue) const {
-        const MethodSymbol* best = nullptr;
-        int best_score = -1;
-
         const ClassSymbol* cur = &get_class(static_class);
         while (cur) {
             auto it = cur->methods.find(method);
             if (it != cur->methods.end()) {
+                const MethodSymbol* match = nullptr;
+                bool ambiguous = false;
                 for (const auto& cand : it->second) {
-                    if (cand.param_types.size() != arg_base_types.size()) continue;
-
-                    bool ok = true;
-                    int score = 0;
-
-                    for (size_t i = 0; i < arg_base_types.size(); ++i) {
-                        ast::Type par = cand.param_types[i];
-                        ast::Type par_base = base_type(par);
-
-                        // Param base type muss exakt passen
-                        if (par_base != arg_base_types[i]) { ok = false; break; }
-
-                        // Ref-Param braucht lvalue-Arg
-                        if (par.is_ref) {
-                            if (!arg_is_lvalue[i]) { ok = false; break; }
-                            score += 1;
-                        }
-                    }
-
-                    if (!ok) continue;
-
-                    if (score > best_score) {
-                        best_score = score;
-                        best = &cand;
-                    } else if (score == best_score) {
-                        throw std::runtime_error("semantic error: ambiguous overload: " + method);
-                    }
+                    if (!params_accept(cand.param_types, arg_base_types, arg_is_lvalue)) continue;
+                    if (match) ambiguous = true;
+                    match = &cand;
                 }
+                if (match && !ambiguous) return *match;
             }
 
             if (cur->base_name.empty()) break;
             cur = &get_class(cur->base_name);
         }
 
-        if (!best) throw std::runtime_error("semantic error: no matching overload: " + method);
-        return *best;
+        throw std::runtime_error("semantic error: no matching overload: " + method);
     }
 
-    // Overload-Resolution für Konstruktor-Aufruf innerhalb einer Klasse:
-    // - base type exakt
-    // - Ref-Params brauchen lvalue
-    // - Score: +1 pro ref param
-    const CtorSymbol& resolve_ctor_call(const std::string& class_name,
-                                       const std::vector<ast::Type>& arg_base_types,
-                                       const std::vector<bool>& arg_is_lvalue) const {
+    // Prüft einen Konstruktor-Aufruf T(args) (wie interp::ClassRuntime::find_ctor_plan):
+    // - eigene Konstruktoren: exakte Basistypen, Ref-Params brauchen lvalue
+    // - mehrere passende -> ambiguous
+    // - sonst impliziter Copy-Ctor: ein Argument vom Typ T oder abgeleitet
+    void check_ctor_call(const std::string& class_name,
+                         const std::vector<ast::Type>& arg_base_types,
+                         const std::vector<bool>& arg_is_lvalue) const {
         const auto& cs = get_class(class_name);
 
-        const CtorSymbol* best = nullptr;
-        int best_score = -1;
-
+        const CtorSymbol* match = nullptr;
         for (const auto& cand : cs.ctors) {
-            if (cand.param_types.size() != arg_base_types.size()) continue;
-
-            bool ok = true;
-            int score = 0;
+            if (!params_accept(cand.param_types, arg_base_types, arg_is_lvalue)) continue;
+            if (match) throw std::runtime_error("semantic error: ambiguous constructor call: " + class_name);
+            match = &cand;
+        }
+        if (match) return;
 
-            for (size_t i = 0; i < arg_base_types.size(); ++i) {
-                ast::Type par = cand.param_types[i];
-                ast::Type par_base = base_type(par);
+        if (arg_base_types.size() == 1 &&
+            arg_base_types[0].base == ast::Type::Base::Class &&
+            is_same_or_derived(arg_base_types[0].class_name, class_name)) {
+            return;
+        }
 
-                if (par_base != arg_base_types[i]) { ok = false; break; }
+        throw std::runtime_error("semantic error: no matching constructor: " + class_name);
+    }
 
-                if (par.is_ref) {
-                    if (!arg_is_lvalue[i]) { ok = false; break; }
-                    score += 1;
-                }
-            }
+    // Parameterlisten, die zur Laufzeit für dieselben Argumente in Frage kommen können:
+    // gleiche Basistypen, bei Klassen genügt Verwandtschaft (der Interpreter wählt
+    // Overloads nach dem *dynamischen* Typ der Objekte)
+    bool params_may_overlap(const std::vector<ast::Type>& a, const std::vector<ast::Type>& b) const {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            ast::Type x = base_type(a[i]);
+            ast::Type y = base_type(b[i]);
+            if (x == y) continue;
+            if (x.base != ast::Type::Base::Class || y.base != ast::Type::Base::Class) return false;
+            if (!is_same_or_derived(x.class_name, y.class_name) &&
+                !is_same_or_derived(y.class_name, x.class_name)) return false;
+        }
+        return true;
+    }
 
-            if (!ok) continue;
+    // true, wenn statische Typen den Laufzeittyp jedes Ausdrucks festlegen.
+    // Das gilt nicht mehr, sobald
+    // - eine abgeleitete Klasse ein geerbtes Feld mit anderem Typ verdeckt
+    //   (Methoden sehen die Felder des dynamischen Objekts), oder
+    // - Methoden-Overloads der Kette für dieselben Argumente mit verschiedenen
+    //   Rückgabetypen in Frage kommen (Auflösung über den dynamischen Typ).
+    bool static_types_reliable() const {
+        for (const auto& [name, cs] : classes) {
+            if (cs.base_name.empty()) continue;
 
-            if (score > best_score) {
-                best_score = score;
-                best = &cand;
-            } else if (score == best_score) {
-                throw std::runtime_error("semantic error: ambiguous constructor call: " + class_name);
+            for (const auto& [fname, ftype] : cs.fields) {
+                if (has_field_in_chain(cs.base_name, fname) &&
+                    base_type(field_type_in_chain(cs.base_name, fname)) != base_type(ftype))
+                    return false;
             }
         }
 
-        if (!best) throw std::runtime_error("semantic error: no matching constructor: " + class_name);
-        return *best;
+        for (const auto& [name, cs] : classes) {
+            for (const auto& [mname, overloads] : cs.methods) {
+                for (const auto& dm : overloads) {
+                    const ClassSymbol* cur = &cs;
+                    while (cur) {
+                        auto it = cur->methods.find(mname);
+                        if (it != cur->methods.end()) {
+                            for (const auto& am : it->second) {
+                                if (&am == &dm) continue;
+                                if (am.return_type != dm.return_type &&
+                                    params_may_overlap(am.param_types, dm.param_types))
+                                    return false;
+                            }
+                        }
+                        if (cur->base_name.empty()) break;
+                        cur = &get_class(cur->base_name);
+                    }
+                }
+            }
+        }
+        return true;
     }
 };
 
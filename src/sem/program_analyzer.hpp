@@ -5,7 +5,7 @@
 #include <string>    // std::string
 
 #include "analyzer.hpp"      // Analyzer: type_of_expr/check_stmt/check_function/check_method/check_constructor
-#include "scope.hpp"         // Scope: globale Symboltabelle (Funktionen/Klassen)
+#include "scope.hpp"         // Scope: globale Symboltabelle (Funktionen)
 #include "class_table.hpp"   // ClassTable: Klassenhierarchie + Member-Signaturen
 #include "../ast/program.hpp"// AST: Program
 #include "../ast/type.hpp"   // AST: Type
@@ -17,6 +17,10 @@ namespace sem {
 struct ProgramAnalyzer {
     Analyzer analyzer; // wiederverwendbarer Analyzer (benötigt ClassTable-Pointer)
 
+    // Nach analyze(): statische Typen im AST eingetragen (sonst hängen Overloads und
+    // Ergebnistypen vom dynamischen Objekttyp ab, nur der Interpreter kennt sie)
+    bool annotated() const { return analyzer.annotate; }
+
     // Prüft main-Signatur (nur wenn main existiert):
     // erlaubt: int main() oder void main()
     static void check_main_signature(const Scope& global) {
@@ -39,24 +43,37 @@ struct ProgramAnalyzer {
         if (!ok) throw std::runtime_error("semantic error: invalid main signature");
     }
 
+    // Funktions-Overloads, die zur Laufzeit (Auflösung nach dynamischem Objekttyp)
+    // für dieselben Argumente in Frage kommen, müssen denselben Rückgabetyp haben,
+    // sonst ist der statische Typ eines Aufrufs nicht verlässlich
+    static bool function_types_reliable(const Scope& global, const ClassTable& ct) {
+        for (const auto& [name, ovs] : global.funcs) {
+            for (size_t i = 0; i < ovs.size(); ++i)
+                for (size_t j = i + 1; j < ovs.size(); ++j)
+                    if (ovs[i].return_type != ovs[j].return_type &&
+                        ct.params_may_overlap(ovs[i].param_types, ovs[j].param_types))
+                        return false;
+        }
+        return true;
+    }
+
     // Führt die vollständige semantische Analyse aus:
     // 1) Klassen-Infos bauen (ClassTable)
-    // 2) globalen Scope mit Klassen + Funktionssignaturen füllen
+    // 2) globalen Scope mit Funktionssignaturen füllen
     // 3) main-Signatur prüfen
     // 4) Analyzer auf Funktionen, Konstruktoren und Methoden anwenden
-    void analyze(const ast::Program& p) {
+    //    (statische Typen werden nur eingetragen, wenn sie zur Laufzeit verlässlich sind)
+    void analyze(ast::Program& p) {
         // Klassenstruktur und Member-Signaturen sammeln/validieren
         ClassTable ct;
-        ct.build(p);
+        for (const auto& c : p.classes) located(c.loc, [&] { ct.add_class_name(c.name); });
+        for (const auto& c : p.classes) located(c.loc, [&] { ct.fill_class_members(c); });
+        ct.check_inheritance();
+        ct.check_overrides_and_virtuals();
 
-        // Globaler Scope enthält Klassennamen + Funktionsüberladungen
+        // Globaler Scope enthält die Funktionsüberladungen
         Scope global(nullptr);
 
-        // Klassen registrieren (für Typchecks: "ist das ein Klassentyp?")
-        for (const auto& c : p.classes) {
-            global.define_class(c.name);
-        }
-
         // Funktionssignaturen registrieren (Overload-Resolution im Analyzer)
         for (const auto& f : p.functions) {
             FuncSymbol sym;
@@ -66,7 +83,7 @@ struct ProgramAnalyzer {
             sym.param_types.reserve(f.params.size());
             for (const auto& par : f.params) sym.param_types.push_back(par.type);
 
-            global.define_func(sym);
+            located(f.loc, [&] { global.define_func(sym); });
         }
 
         // main() optional, aber wenn vorhanden muss Signatur passen
@@ -77,14 +94,19 @@ struct ProgramAnalyzer {
         // - field/method lookup in inheritance chain
         // - ctor/method overload resolution bei Klassen
         analyzer.set_class_table(&ct);
+        analyzer.annotate = ct.static_types_reliable() && function_types_reliable(global, ct);
+
+        // Feldtypen müssen existieren
+        for (const auto& c : p.classes)
+            for (const auto& f : c.fields) located(f.loc, [&] { analyzer.check_type_exists(f.type); });
 
         // Funktionen typechecken
-        for (const auto& f : p.functions) analyzer.check_function(global, f);
+        for (auto& f : p.functions) analyzer.check_function(global, f);
 
         // Klassen-Member typechecken (Ctors & Methoden)
-        for (const auto& c : p.classes) {
-            for (const auto& ctor : c.ctors) analyzer.check_constructor(global, ct, c.name, ctor);
-            for (const auto& m : c.methods) analyzer.check_method(global, ct, c.name, m);
+        for (auto& c : p.classes) {
+            for (auto& ctor : c.ctors) analyzer.check_constructor(global, ct, c.name, ctor);
+            for (auto& m : c.methods) analyzer.check_method(global, ct, c.name, m);
         }
     }
 };
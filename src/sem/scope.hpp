@@ -44,6 +44,13 @@ struct Scope {
         throw std::runtime_error("semantic error: unknown variable: " + name);
     }
 
+    // Prüft die gesamte Scope-Kette.
+    bool has_var(const std::string& name) const {
+        for (const Scope* s = this; s; s = s->parent)
+            if (s->vars.find(name) != s->vars.end()) return true;
+        return false;
+    }
+
     // Prüft nur den aktuellen Scope (ohne parent).
     bool has_var_local(const std::string& name) const {
         return vars.find(name) != vars.end();
@@ -62,42 +69,49 @@ struct Scope {
         vec.push_back(f);
     }
 
-    // Overload-Resolution für Funktionsaufrufe:
-    // - sucht zuerst in diesem Scope, sonst in parents
-    // - matcht *exakt* die Parametertypen (keine Konversionen)
-    // - wenn mehrere exakt passen -> ambiguous
-    const FuncSymbol& resolve_func(const std::string& name, const std::vector<ast::Type>& arg_types) const {
-        const Scope* s = this;
+    // Prüft, ob der Funktionsname in der Scope-Kette existiert.
+    bool has_func(const std::string& name) const {
+        for (const Scope* s = this; s; s = s->parent)
+            if (s->funcs.find(name) != s->funcs.end()) return true;
+        return false;
+    }
 
-        while (s) {
+    // Liefert alle Overloads des innersten Scopes, der den Namen kennt.
+    const std::vector<FuncSymbol>& lookup_funcs(const std::string& name) const {
+        for (const Scope* s = this; s; s = s->parent) {
             auto it = s->funcs.find(name);
-            if (it != s->funcs.end()) {
-                const auto& vec = it->second;
-
-                const FuncSymbol* match = nullptr;
-
-                for (const auto& cand : vec) {
-                    if (cand.param_types.size() != arg_types.size()) continue;
-
-                    bool ok = true;
-                    for (size_t i = 0; i < arg_types.size(); ++i) {
-                        if (cand.param_types[i] != arg_types[i]) { ok = false; break; }
-                    }
-
-                    if (ok) {
-                        if (match) throw std::runtime_error("semantic error: ambiguous overload: " + name);
-                        match = &cand;
-                    }
-                }
+            if (it != s->funcs.end()) return it->second;
+        }
+        throw std::runtime_error("semantic error: unknown function: " + name);
+    }
 
-                if (!match) throw std::runtime_error("semantic error: no matching overload: " + name);
-                return *match;
+    // Overload-Resolution für Funktionsaufrufe (Regeln wie interp::FunctionTable::resolve):
+    // - Basistypen der Parameter müssen exakt passen (keine Konversionen)
+    // - Referenzparameter verlangen lvalue-Argumente
+    // - passen mehrere Overloads -> ambiguous
+    const FuncSymbol& resolve_func(const std::string& name,
+                                   const std::vector<ast::Type>& arg_types,
+                                   const std::vector<bool>& arg_is_lvalue) const {
+        const FuncSymbol* match = nullptr;
+
+        for (const auto& cand : lookup_funcs(name)) {
+            if (cand.param_types.size() != arg_types.size()) continue;
+
+            bool ok = true;
+            for (size_t i = 0; i < arg_types.size(); ++i) {
+                const ast::Type& pt = cand.param_types[i];
+                if (ast::strip_ref(pt) != arg_types[i]) { ok = false; break; }
+                if (pt.is_ref && !arg_is_lvalue[i]) { ok = false; break; }
             }
 
-            s = s->parent;
+            if (ok) {
+                if (match) throw std::runtime_error("semantic error: ambiguous overload: " + name);
+                match = &cand;
+            }
         }
 
-        throw std::runtime_error("semantic error: unknown function: " + name);
+        if (!match) throw std::runtime_error("semantic error: no matching overload: " + name);
+        return *match;
     }
 
     // Prüft, ob im aktuellen Scope irgendein Funktionsname existiert (ohne parent).
@@ -0,0 +1,34 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include "../ast/program.hpp" // AST: Program
+#include "../ast/expr.hpp"    // AST: Expression-Knoten
+#include "../ast/stmt.hpp"    // AST: Statement-Knoten
+#include "../opt/walker.hpp"  // opt::AstWalker
+
+namespace sem {
+
+// Entfernt die statischen Typen (Expr::typed) und die darauf aufbauenden Markierungen
+class StaticTypeEraser : public opt::AstWalker {
+protected:
+    void stmt(ast::StmtPtr& s) override {
+        // Die Escape-Analyse setzt statisch aufgelöste Namen voraus
+        if (auto* b = dynamic_cast<ast::BlockStmt*>(s.get())) b->frame_objects = false;
+        else if (auto* v = dynamic_cast<ast::VarDeclStmt*>(s.get())) v->frame_object = false;
+        children(*s);
+    }
+
+    void expr(ast::ExprPtr& e) override {
+        e->typed = false;
+        children(*e);
+    }
+};
+
+// Entfernt alle statischen Typen eines Programms.
+// Nötig, wenn der REPL Definitionen ergänzt, die die Analyse nicht gesehen hat
+// (z.B. eine abgeleitete Klasse, die ein Feld mit anderem Typ verdeckt).
+inline void clear_static_types(ast::Program& p) {
+    StaticTypeEraser().run(p);
+}
+
+} // namespace sem
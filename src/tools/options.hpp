@@ -0,0 +1,183 @@
+#pragma once
+// Verhindert mehrfaches Einbinden dieser Header-Datei
+
+#include <cstdint>    // std::uint64_t, SIZE_MAX
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+
+namespace mini_cpp {
+
+// Kommandozeilenoptionen des Interpreters
+//   mini_cpp [optionen] [datei.cpp]
+struct Options {
+    std::string script_path;  // Skriptdatei (leer => nur REPL)
+    std::string output_path;  // --output <file>: Ausgabe der print_*-Builtins in Datei
+    std::string input_path;   // --input <file>: Eingabe der read_*-Builtins aus Datei
+
+    bool profile = false;     // --profile: Profil als Text auf stderr
+    std::string profile_json; // --profile-json <file>: Profil als JSON in Datei
+
+    bool no_tco = false;      // --no-tco: Tail-Calls nicht als Schleife ausführen
+    bool no_sem = false;      // --no-sem: keine semantische Analyse vor der Ausführung
+    bool no_jit = false;      // --no-jit: int/bool-Funktionen nicht als Maschinencode ausführen
+    bool no_licm = false;     // --no-licm: keine schleifeninvarianten Ausdrücke herausziehen
+    bool memoize = false;     // --memoize: Ergebnisse reiner Funktionen cachen
+    std::string engine = "tree"; // --engine=<tree|closure>: Ausführungsmodell des Interpreters
+    int inline_size = 12;     // --inline-size <n>: Rümpfe bis n AST-Knoten inline auswerten (0 = aus)
+    std::string emit_cpp_path; // --emit-cpp <file>: Programm nach C++ übersetzen (keine Ausführung)
+    bool native = false;      // --native: übersetzen, mit dem System-Compiler bauen und ausführen
+    bool stats = false;       // --stats: interne Zähler beim Beenden auf stderr
+    bool heap_profile = false; // --heap-profile: Objekte pro Klasse/Allokationsstelle auf stderr
+    bool line_profile = false; // --line-profile: ausgeführte Statements pro Zeile auf stderr
+
+    std::uint64_t max_steps = 0;      // --max-steps <n>: höchstens n Statements (0 = unbegrenzt)
+    std::uint64_t max_depth = 0;      // --max-depth <n>: maximale Aufruftiefe
+    std::uint64_t timeout_ms = 0;     // --timeout-ms <n>: maximale Laufzeit
+    std::uint64_t max_heap_mb = 0;    // --max-heap-mb <n>: maximale Größe lebender Objekte
+
+    std::uint64_t stack_mb = 4096;    // --stack-mb <n>: Interpreter-Stack (reserviert, 0 = Haupt-Thread)
+
+    std::string trace_path;   // --trace <file.json>: Chrome-Trace-Events in Datei
+    int trace_threshold_us = 10; // --trace-threshold-us <n>: Mindestdauer fuer Aufrufe im Trace
+
+    int sample_hz = 0;        // --sample-profile=<hz>: SIGPROF-Sampling (0 = aus)
+    std::string sample_out = "mini_cpp.folded"; // --sample-out <file>: folded stacks
+};
+
+// Liest den Wert einer Option: "--name=wert" oder "--name wert"
+// Liefert false, wenn argv[i] nicht die Option name ist.
+inline bool take_option_value(int argc, char** argv, int& i,
+                              const std::string& name, std::string& out) {
+    const std::string arg = argv[i];
+    if (arg == name) {
+        if (i + 1 >= argc) throw std::runtime_error("Option " + name + " erwartet einen Wert");
+        out = argv[++i];
+        return true;
+    }
+    if (arg.compare(0, name.size() + 1, name + "=") == 0) {
+        out = arg.substr(name.size() + 1);
+        return true;
+    }
+    return false;
+}
+
+// Parst einen ganzzahligen Optionswert (nur Ziffern)
+inline int parse_int_option(const std::string& name, const std::string& value) {
+    if (value.empty() || value.size() > 9 ||
+        value.find_first_not_of("0123456789") != std::string::npos)
+        throw std::runtime_error("Option " + name + " erwartet eine Zahl: " + value);
+    return std::stoi(value);
+}
+
+// Parst einen großen ganzzahligen Optionswert (nur Ziffern)
+inline std::uint64_t parse_u64_option(const std::string& name, const std::string& value) {
+    if (value.empty() || value.size() > 15 ||
+        value.find_first_not_of("0123456789") != std::string::npos)
+        throw std::runtime_error("Option " + name + " erwartet eine Zahl: " + value);
+    return std::stoull(value);
+}
+
+// Profiling in irgendeiner Form aktiv?
+inline bool profiling_requested(const Options& opts) {
+    return opts.profile || !opts.profile_json.empty() || opts.sample_hz > 0 || opts.line_profile ||
+           !opts.trace_path.empty() || opts.stats || opts.heap_profile;
+}
+
+// Profiler (ausser --stats) oder Ausführungslimits aktiv? Diese zählen pro Aufruf bzw.
+// Statement und brauchen daher den Interpreter (kein JIT).
+inline bool per_call_instrumentation(const Options& opts) {
+    return opts.profile || !opts.profile_json.empty() || opts.sample_hz > 0 || opts.line_profile ||
+           !opts.trace_path.empty() || opts.heap_profile || opts.max_steps > 0 || opts.max_depth > 0 ||
+           opts.timeout_ms > 0 || opts.max_heap_mb > 0;
+}
+
+// Parst die Kommandozeile; unbekannte Optionen sind ein Fehler
+inline Options parse_options(int argc, char** argv) {
+    Options opts;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+
+        if (take_option_value(argc, argv, i, "--output", opts.output_path)) continue;
+        if (take_option_value(argc, argv, i, "--input", opts.input_path)) continue;
+        if (take_option_value(argc, argv, i, "--profile-json", opts.profile_json)) continue;
+        if (take_option_value(argc, argv, i, "--sample-out", opts.sample_out)) continue;
+
+        if (take_option_value(argc, argv, i, "--trace", opts.trace_path)) continue;
+        if (take_option_value(argc, argv, i, "--emit-cpp", opts.emit_cpp_path)) continue;
+        if (take_option_value(argc, argv, i, "--engine", opts.engine)) {
+            if (opts.engine != "tree" && opts.engine != "closure")
+                throw std::runtime_error("Option --engine erwartet tree oder closure: " + opts.engine);
+            continue;
+        }
+
+        std::string threshold;
+        if (take_option_value(argc, argv, i, "--trace-threshold-us", threshold)) {
+            opts.trace_threshold_us = parse_int_option("--trace-threshold-us", threshold);
+            continue;
+        }
+        if (take_option_value(argc, argv, i, "--inline-size", threshold)) {
+            opts.inline_size = parse_int_option("--inline-size", threshold);
+            continue;
+        }
+
+        std::string limit;
+        if (take_option_value(argc, argv, i, "--max-steps", limit)) {
+            opts.max_steps = parse_u64_option("--max-steps", limit);
+            continue;
+        }
+        if (take_option_value(argc, argv, i, "--max-depth", limit)) {
+            opts.max_depth = parse_u64_option("--max-depth", limit);
+            continue;
+        }
+        if (take_option_value(argc, argv, i, "--timeout-ms", limit)) {
+            opts.timeout_ms = parse_u64_option("--timeout-ms", limit);
+            continue;
+        }
+        if (take_option_value(argc, argv, i, "--stack-mb", limit)) {
+            opts.stack_mb = parse_u64_option("--stack-mb", limit);
+            // In Bytes umgerechnet muss die Größe in size_t passen (sonst Überlauf auf 0)
+            if (opts.stack_mb > (SIZE_MAX >> 20))
+                throw std::runtime_error("Option --stack-mb zu groß: " + limit);
+            continue;
+        }
+        if (take_option_value(argc, argv, i, "--max-heap-mb", limit)) {
+            opts.max_heap_mb = parse_u64_option("--max-heap-mb", limit);
+            continue;
+        }
+
+        std::string hz;
+        if (take_option_value(argc, argv, i, "--sample-profile", hz)) {
+            opts.sample_hz = parse_int_option("--sample-profile", hz);
+            continue;
+        }
+
+        if (arg == "--profile") { opts.profile = true; continue; }
+        if (arg == "--line-profile") { opts.line_profile = true; continue; }
+        if (arg == "--stats") { opts.stats = true; continue; }
+        if (arg == "--no-tco") { opts.no_tco = true; continue; }
+        if (arg == "--no-sem") { opts.no_sem = true; continue; }
+        if (arg == "--no-jit") { opts.no_jit = true; continue; }
+        if (arg == "--no-licm") { opts.no_licm = true; continue; }
+        if (arg == "--memoize") { opts.memoize = true; continue; }
+        if (arg == "--native") { opts.native = true; continue; }
+        if (arg == "--heap-profile") { opts.heap_profile = true; continue; }
+
+        if (!arg.empty() && arg[0] == '-')
+            throw std::runtime_error("unbekannte Option: " + arg);
+
+        if (!opts.script_path.empty())
+            throw std::runtime_error("mehr als eine Skriptdatei angegeben: " + arg);
+        opts.script_path = arg;
+    }
+
+    if ((!opts.emit_cpp_path.empty() || opts.native) && opts.script_path.empty())
+        throw std::runtime_error("--emit-cpp/--native benoetigen eine Skriptdatei");
+    // Das native Binary zählt weder Schritte noch Aufrufe: Limits würden stillschweigend fehlen
+    if (opts.native && (per_call_instrumentation(opts) || opts.stats))
+        throw std::runtime_error("--native unterstützt keine Ausführungslimits, Profiler, --trace "
+                                 "oder --stats (nur im Interpreter)");
+    return opts;
+}
+
+} // namespace mini_cpp
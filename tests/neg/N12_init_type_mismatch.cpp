@@ -0,0 +1,7 @@
+int main() {
+    int x = true; // Fehler: bool ist kein int (keine impliziten Konversionen)
+
+    print_int(x);
+
+    return 0;
+}
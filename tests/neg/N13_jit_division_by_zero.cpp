@@ -0,0 +1,11 @@
+// ERROR: 4:5: runtime error: division by zero
+// Laufzeitfehler im JIT-Code tragen die Position des Statements wie im Interpreter
+int ratio(int a, int b) {
+    return a / b;
+}
+
+int main() {
+    print_int(ratio(6, 3));
+    print_int(ratio(1, 0));
+    return 0;
+}
@@ -0,0 +1,10 @@
+// ERROR: 4:5: runtime error: read_int: end of input
+// read_int am Eingabeende ist ein Laufzeitfehler an der Position des Statements in next()
+int next() {
+    return read_int();
+}
+
+int main() {
+    int x = next() + read_int();
+    return 0;
+}
@@ -0,0 +1,25 @@
+// ARGS: --native
+// ERROR: --emit-cpp/--native: Overloads bzw. Feldtypen hängen vom dynamischen Objekttyp ab
+// g(r) wählt zur Laufzeit g(B) (bool): der Interpreter meldet "expected int in +",
+// übersetzter Code würde g(A) aufrufen und 2 ausgeben
+class A {
+public:
+    int v;
+    A() { v = 1; }
+};
+
+class B : public A {
+public:
+    B() { v = 2; }
+};
+
+int g(A a) { return 1; }
+bool g(B b) { return true; }
+
+int main() {
+    B b;
+    A& r = b;
+    int y = g(r) + 1;
+    print_int(y);
+    return 0;
+}
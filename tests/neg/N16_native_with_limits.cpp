@@ -0,0 +1,8 @@
+// ARGS: --native --max-steps 1000
+// ERROR: --native unterstützt keine Ausführungslimits
+// Das native Binary zählt keine Schritte: die Endlosschleife liefe ohne Limit weiter
+int main() {
+    while (true) {
+    }
+    return 0;
+}
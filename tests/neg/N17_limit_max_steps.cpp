@@ -0,0 +1,14 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --max-steps 1000
+// SKIP-WITH: --native
+// EXIT: 3
+// ERROR: limit exceeded: more than 1000 statements executed (--max-steps)
+// Die Schleife endet nie: nach 1000 Statements bricht der Lauf mit Exit-Code 3 ab
+int main() {
+    int i = 0;
+    while (true) {
+        i = i + 1;
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --max-depth 10
+// SKIP-WITH: --native
+// EXIT: 3
+// ERROR: limit exceeded: call depth above 10 (--max-depth)
+// Kein Tail-Call (das Ergebnis wird weiterverrechnet): jede Ebene bleibt auf dem Stack
+int down(int n) {
+    if (n == 0) {
+        return 0;
+    }
+    int r = down(n - 1);
+    return r + 1;
+}
+
+int main() {
+    print_int(down(100));
+    return 0;
+}
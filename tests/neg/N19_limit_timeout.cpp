@@ -0,0 +1,14 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --timeout-ms 50
+// SKIP-WITH: --native
+// EXIT: 3
+// ERROR: limit exceeded: running longer than 50 ms (--timeout-ms)
+// Endlosschleife ohne Schrittlimit: nur die Uhr beendet den Lauf
+int main() {
+    int i = 0;
+    while (true) {
+        i = i + 1;
+    }
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --max-heap-mb 1
+// SKIP-WITH: --native
+// EXIT: 3
+// ERROR: limit exceeded: live objects above 1 MiB (--max-heap-mb)
+// 100000 Ebenen halten je ein Node: die lebenden Objekte wachsen über 1 MiB
+class Node {
+public:
+    int a;
+    int b;
+    Node() { a = 1; b = 2; }
+};
+
+// Jede Ebene hält ihr Node bis zum Rücksprung
+int keep(int n) {
+    Node node = Node();
+    if (n == 0) return node.a;
+    return keep(n - 1) + node.b;
+}
+
+int main() {
+    print_int(keep(100000));
+    return 0;
+}
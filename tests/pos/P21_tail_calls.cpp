@@ -0,0 +1,101 @@
+#include "hsbi_runtime.h"
+
+// Akkumulator in Tail-Position
+int sum(int n, int acc) {
+    if (n == 0) {
+        return acc;
+    }
+    return sum(n - 1, acc + n);
+}
+
+// Variablen als Argumente für Wertparameter (string: nicht im JIT)
+int walk(int n, int acc, string tag) {
+    if (n == 0) {
+        return acc;
+    }
+    acc = acc + 1;
+    return walk(n - 1, acc, tag);
+}
+
+// wechselseitige Rekursion
+bool is_even(int n) {
+    if (n == 0) {
+        return true;
+    }
+    return is_odd(n - 1);
+}
+
+bool is_odd(int n) {
+    if (n == 0) {
+        return false;
+    }
+    return is_even(n - 1);
+}
+
+// Referenzparameter wird durchgereicht
+int count_into(int &x, int n) {
+    if (n == 0) {
+        return x;
+    }
+    x = x + 1;
+    return count_into(x, n - 1);
+}
+
+// Referenz auf eine lokale Variable: darf den Frame nicht verlieren
+int via_local(int n) {
+    int y = n;
+    if (n == 0) {
+        return 0;
+    }
+    return add_local(y, n);
+}
+
+int add_local(int &y, int n) {
+    y = y + 1;
+    return via_local(n - 1) + y;
+}
+
+class Counter {
+public:
+    int steps;
+
+    Counter() {
+        steps = 0;
+    }
+
+    int run(Counter &self, int n) {
+        if (n == 0) {
+            return steps;
+        }
+        steps = steps + 1;
+        return self.run(self, n - 1);
+    }
+};
+
+int main() {
+    print_int(sum(60000, 0));       // 1800030000
+    print_bool(is_even(100001));    // 0
+    print_int(walk(30000, 0, "w"));  // 30000
+
+    int x = 0;
+    print_int(count_into(x, 50000)); // 50000
+    print_int(x);                    // 50000
+
+    print_int(via_local(100));       // 5150
+
+    Counter c;
+    print_int(c.run(c, 20000));      // 20000
+    print_int(c.steps);              // 20000
+
+    return 0;
+}
+/* EXPECT:
+1800030000
+0
+30000
+50000
+50000
+5150
+20000
+20000
+*/
@@ -0,0 +1,85 @@
+#include "hsbi_runtime.h"
+
+// Kleine Funktionen und Methoden (Getter/Setter), die inline ausgewertet werden
+
+class Point {
+public:
+    int x;
+    int y;
+
+    Point() { x = 0; y = 0; }
+
+    int getX() { return x; }
+    void setX(int v) { x = v; }
+    void move(int dx, int dy) { x = x + dx; y = y + dy; }
+    void store_sum(int &out) { out = x + y; }
+    virtual int kind() { return 1; }
+};
+
+class Point3 : public Point {
+public:
+    int z;
+
+    Point3() { z = 0; }
+
+    // verdeckt Point::getX (nicht virtuell)
+    int getX() { return 100 + x; }
+    int kind() { return 3; }
+};
+
+int add(int a, int b) { return a + b; }
+
+void inc(int &r) { r = r + 1; }
+
+// Referenzparameter und Wertparameter auf dieselbe Variable
+int set_then_add(int &r, int v) {
+    r = 5;
+    return r + v;
+}
+
+int main() {
+    Point p;
+    p.setX(3);
+    p.move(1, 2);
+    print_int(p.getX());          // 4
+
+    int s = 0;
+    p.store_sum(s);
+    print_int(s);                 // 6
+
+    Point3 q;
+    q.setX(7);
+    print_int(q.getX());          // 107
+
+    Point &r = q;
+    print_int(r.getX());          // 7 (statischer Typ Point)
+    print_int(r.kind());          // 3 (virtuell)
+
+    int a = 1;
+    inc(a);
+    inc(a);
+    print_int(a);                 // 3
+    print_int(set_then_add(a, a)); // 8
+    print_int(a);                 // 5
+
+    int i = 0;
+    int sum = 0;
+    while (i < 100) {
+        sum = add(sum, i);
+        i = i + 1;
+    }
+    print_int(sum);               // 4950
+
+    return 0;
+}
+/* EXPECT:
+4
+6
+107
+7
+3
+3
+8
+5
+4950
+*/
@@ -0,0 +1,93 @@
+#include "hsbi_runtime.h"
+
+// Schleifeninvariante Ausdrücke und Aliase: das Herausziehen darf nichts ändern
+
+class Box {
+public:
+    int w;
+    int h;
+
+    Box() { w = 2; h = 3; }
+
+    int area() { return w * h; }
+    void grow() { w = w + 1; }
+
+    // Feld und Referenzparameter aliasieren: out kann w sein
+    int sum_area(int n, int &out) {
+        int i = 0;
+        int s = 0;
+        while (i < n) {
+            s = s + w * h;
+            out = out + 1;
+            i = i + 1;
+        }
+        return s;
+    }
+};
+
+// a und b können dieselbe Variable sein
+int twice(int &a, int &b, int n) {
+    int i = 0;
+    int s = 0;
+    while (i < n) {
+        s = s + a * 2;
+        b = b + 1;
+        i = i + 1;
+    }
+    return s;
+}
+
+int main() {
+    int n = 4;
+    int i = 0;
+    int s = 0;
+    while (i < n * 2) {          // n * 2 ist invariant
+        s = s + n * n;
+        i = i + 1;
+    }
+    print_int(s);                // 128
+
+    // Schreiben über eine Referenz auf n
+    int &r = n;
+    i = 0;
+    s = 0;
+    while (i < n * 2) {
+        r = r - 1;
+        s = s + 1;
+        i = i + 1;
+    }
+    print_int(s);                // 3
+
+    // Setter in der Schleife ändert das gelesene Feld
+    Box b;
+    i = 0;
+    s = 0;
+    while (i < 3) {
+        s = s + b.area() + b.w;
+        b.grow();
+        i = i + 1;
+    }
+    print_int(s);                // 6+2 + 9+3 + 12+4 = 36
+
+    print_int(b.sum_area(2, b.w));   // 5*3 + 6*3 = 33
+    int x = 1;
+    print_int(twice(x, x, 3));       // 2 + 4 + 6 = 12
+
+    // Rumpf läuft nie: 10 / z darf nicht vorab ausgewertet werden
+    int z = 0;
+    int k = 0;
+    while (k > 0) {
+        s = s + 10 / z;
+    }
+    print_int(k);                // 0
+    return 0;
+}
+
+/* EXPECT:
+128
+3
+36
+33
+12
+0
+*/
@@ -0,0 +1,119 @@
+#include "hsbi_runtime.h"
+
+// Escape-Analyse: Objekte nicht entkommender Locals liegen im Frame
+
+class Vec {
+public:
+    int x;
+    int y;
+
+    Vec() { x = 0; y = 0; }
+    Vec(int a, int b) { x = a; y = b; }
+
+    int dot(Vec& o) { return x * o.x + y * o.y; }
+    void add(int d) { x = x + d; y = y + d; }
+
+    int times(int k) {
+        int s = 0;
+        while (k > 0) {
+            s = s + x;
+            k = k - 1;
+        }
+        return s;
+    }
+};
+
+class Holder {
+public:
+    Vec v;
+
+    Holder() { }
+};
+
+// entkommt: return
+Vec make(int a) {
+    Vec t = Vec(a, a + 1);
+    return t;
+}
+
+// entkommt: Argument, das im Feld eines Objekts des Aufrufers landet
+void keep(Holder& h, Vec p) {
+    h.v = p;
+}
+
+void store(Holder& h, int a) {
+    Vec t = Vec(a, a);
+    keep(h, t);
+}
+
+// entkommt: Feldzuweisung
+void store_direct(Holder& h, int a) {
+    Vec t = Vec(a, 2 * a);
+    h.v = t;
+}
+
+// nicht entkommend: Empfänger, Feldzugriffe, tiefe Kopien
+int local_sum(int n) {
+    int s = 0;
+    int i = 0;
+    while (i < n) {
+        Vec a = Vec(i, 1);
+        Vec b;
+        b = a;
+        b.add(1);
+        Vec c = b;
+        c.x = c.x + 1;
+        s = s + a.x + b.y + c.x;
+        i = i + 1;
+    }
+    return s;
+}
+
+// Tail-Call auf einem Frame-Objekt: der Frame darf vorher nicht abgebaut werden
+int tail_receiver(int k) {
+    Vec a;
+    a.x = 40;
+    return a.times(k * 1);
+}
+
+int plus(int& r, int k) {
+    return r + k;
+}
+
+// Tail-Call mit Referenz auf ein Feld eines Frame-Objekts
+int tail_field_ref(int k) {
+    Vec a;
+    a.y = 50;
+    return plus(a.y, k + 0);
+}
+
+int main() {
+    Vec m = make(3);
+    print_int(m.x + m.y);        // 7
+
+    Holder h;
+    store(h, 5);
+    print_int(h.v.x);            // 5
+    store_direct(h, 4);
+    print_int(h.v.y);            // 8
+
+    print_int(local_sum(4));     // a.x: 6, b.y: 8, c.x: 6+4+4 = 14 => 28
+
+    Vec p = Vec(1, 2);
+    Vec q = Vec(3, 4);
+    print_int(p.dot(q));         // 11
+
+    print_int(tail_receiver(2)); // 80
+    print_int(tail_field_ref(3)); // 53
+    return 0;
+}
+
+/* EXPECT:
+7
+5
+8
+28
+11
+80
+53
+*/
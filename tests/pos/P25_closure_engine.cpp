@@ -0,0 +1,97 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --engine=closure --no-jit
+// Closure-Engine: freie Funktionen mit bool/int/char/string laufen als Closure-Baum,
+// alles andere im Baum-Interpreter (Aufrufe in beide Richtungen)
+
+int count_below(string s, char limit, int n) {
+    int count = 0;
+    int i = 0;
+    while (i < n) {
+        if (limit > 'a') {
+            count = count + 1;
+        }
+        i = i + 1;
+    }
+    return count;
+}
+
+bool same(string a, string b) {
+    return a == b;
+}
+
+string pick(bool first, string a, string b) {
+    if (first) {
+        return a;
+    }
+    return b;
+}
+
+// Selbstaufruf in Tail-Position
+int gcd(int a, int b, string tag) {
+    if (b == 0) {
+        return a;
+    }
+    return gcd(b, a % b, tag);
+}
+
+// wechselseitige Tail-Calls
+int ping(int n, string tag) {
+    if (n == 0) {
+        return 0;
+    }
+    return pong(n - 1, tag);
+}
+
+int pong(int n, string tag) {
+    if (n == 0) {
+        return 1;
+    }
+    return ping(n - 1, tag);
+}
+
+class Box {
+public:
+    int v;
+    Box(int x) { v = x; }
+};
+
+// Klassen-Local: bleibt beim Baum-Interpreter
+int boxed(int x) {
+    Box b = Box(x);
+    return b.v;
+}
+
+int twice_boxed(int x, string tag) {
+    return boxed(x) * 2;
+}
+
+void shout(string s, char c, bool b) {
+    print_string(s);
+    print_char(c);
+    print_bool(b);
+}
+
+int main() {
+    print_int(count_below("x", 'z', 5));   // 5
+    print_bool(same("ab", "ab"));          // 1
+    print_bool(same("ab", "ba"));          // 0
+    print_string(pick(false, "a", "b"));   // b
+    print_int(gcd(1071, 462, "g"));        // 21
+    print_int(ping(100001, "p"));          // 1
+    print_int(twice_boxed(21, "t"));       // 42
+    shout("hi", '!', true);
+    return 0;
+}
+/* EXPECT:
+5
+1
+0
+b
+21
+1
+42
+hi
+!
+1
+*/
@@ -0,0 +1,48 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --memoize
+// Memoisierung reiner Funktionen: ohne Cache bräuchte binom(26, 13) rund 20 Millionen
+// Aufrufe, fib(40) über 300 Millionen
+
+int binom(int n, int k) {
+    if (k == 0 || k == n) {
+        return 1;
+    }
+    return binom(n - 1, k - 1) + binom(n - 1, k);
+}
+
+int fib(int n) {
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+// nicht rekursiv und rein: Cache vor dem übersetzten Code
+int square(int x) {
+    int r = x * x;
+    return r;
+}
+
+// nicht rein (Ausgabe): wird bei jedem Aufruf ausgeführt
+int noisy(int x) {
+    print_int(x);
+    return x;
+}
+
+int main() {
+    print_int(binom(26, 13));     // 10400600
+    print_int(fib(40));           // 102334155
+    print_int(square(12) + square(12)); // 288
+    int s = noisy(7) + noisy(7);  // 7, 7
+    print_int(s);                 // 14
+    return 0;
+}
+/* EXPECT:
+10400600
+102334155
+288
+7
+7
+14
+*/
@@ -0,0 +1,62 @@
+#include "hsbi_runtime.h"
+
+// Baseline-JIT: Funktionen nur mit int/bool laufen als Maschinencode
+// (Schleifen, Aufrufe, Ausgabe, Selbstaufrufe in Tail-Position als Sprung)
+
+bool is_prime(int n) {
+    if (n < 2) {
+        return false;
+    }
+    int d = 2;
+    while (d * d <= n) {
+        if (n % d == 0) {
+            return false;
+        }
+        d = d + 1;
+    }
+    return true;
+}
+
+int count_primes(int limit) {
+    int count = 0;
+    int i = 0;
+    while (i < limit) {
+        if (is_prime(i)) {
+            count = count + 1;
+        }
+        i = i + 1;
+    }
+    return count;
+}
+
+// Tail-Rekursion mit 100000 Ebenen
+int sum_to(int n, int acc) {
+    if (n == 0) {
+        return acc;
+    }
+    return sum_to(n - 1, acc + n % 7);
+}
+
+void print_flags(int n) {
+    print_bool(n > 0 && n % 2 == 0);
+    print_bool(!(n > 0) || n == 3);
+    print_int(-n);
+}
+
+int main() {
+    print_int(count_primes(10000)); // 1229
+    print_int(sum_to(100000, 0));   // 300000
+    print_flags(4);
+    print_flags(3);
+    return 0;
+}
+/* EXPECT:
+1229
+300000
+1
+0
+-4
+0
+1
+-3
+*/
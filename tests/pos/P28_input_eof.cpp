@@ -0,0 +1,30 @@
+#include "hsbi_runtime.h"
+
+// Eingabe-Builtins ohne Eingabe (der Testlauf liest von /dev/null)
+
+int sum_all() {
+    int sum = 0;
+    while (has_int()) {
+        sum = sum + read_int();
+    }
+    return sum;
+}
+
+int main() {
+    print_bool(has_input());          // 0
+    print_bool(has_int());            // 0
+    print_int(sum_all());             // 0
+    print_bool(read_char() == '\0');  // 1
+    string line = read_line();
+    print_bool(line == "");           // 1
+    print_bool(has_input());          // 0
+    return 0;
+}
+/* EXPECT:
+0
+0
+0
+1
+1
+0
+*/
@@ -0,0 +1,72 @@
+#include "hsbi_runtime.h"
+
+// ARGS: --max-depth 50
+// SKIP-WITH: --native
+// Tail-Calls ersetzen den Frame: 100000 Ebenen bleiben unter einer Aufruftiefe von 50
+// (mit --no-tco: "limit exceeded: call depth above 50")
+
+// Selbstaufruf (string: nicht im JIT)
+int count(int n, int acc, string tag) {
+    if (n == 0) {
+        return acc;
+    }
+    return count(n - 1, acc + 1, tag);
+}
+
+// wechselseitig
+bool is_even(int n, string tag) {
+    if (n == 0) {
+        return true;
+    }
+    return is_odd(n - 1, tag);
+}
+
+bool is_odd(int n, string tag) {
+    if (n == 0) {
+        return false;
+    }
+    return is_even(n - 1, tag);
+}
+
+// Referenzparameter auf eine Variable des Aufrufers
+int bump(int &x, int n) {
+    if (n == 0) {
+        return x;
+    }
+    x = x + 2;
+    return bump(x, n - 1);
+}
+
+class Walker {
+public:
+    int steps;
+
+    Walker() {
+        steps = 0;
+    }
+
+    // Methodenaufruf in Tail-Position
+    int walk(Walker &self, int n) {
+        if (n == 0) {
+            return steps;
+        }
+        steps = steps + 1;
+        return self.walk(self, n - 1);
+    }
+};
+
+int main() {
+    print_int(count(100000, 0, "c"));  // 100000
+    print_bool(is_even(100001, "e"));  // 0
+    int x = 0;
+    print_int(bump(x, 100000));        // 200000
+    Walker w;
+    print_int(w.walk(w, 100000));      // 100000
+    return 0;
+}
+/* EXPECT:
+100000
+0
+200000
+100000
+*/
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# Testlauf: tests/run_tests.sh <mini_cpp> [optionen...]
+#
+# tests/pos/*.cpp: Exit-Code 0, stdout gleich dem /* EXPECT: ... */-Block (falls vorhanden)
+# tests/neg/*.cpp: Exit-Code ungleich 0; steht im Test "// ERROR: text", muss stderr text enthalten,
+#                  mit "// EXIT: n" muss der Exit-Code genau n sein (z.B. 3 für Limits)
+#
+# Die Optionen gelten fuer jeden Test (z.B. --engine=closure, --native); eine Zeile
+# "// ARGS: ..." im Test ergänzt eigene Optionen, "// SKIP-WITH: opt" überspringt den Test,
+# wenn opt unter den Optionen des Laufs ist (z.B. Limits mit --native). stdin ist leer: kein
+# REPL, read_* sehen sofort das Eingabeende.
+set -u
+
+if [ $# -lt 1 ]; then
+    echo "Aufruf: $0 <mini_cpp> [optionen...]" >&2
+    exit 2
+fi
+bin=$1
+shift
+
+dir=$(cd "$(dirname "$0")" && pwd)
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+total=0
+failed=0
+skipped=0
+
+fail() {
+    failed=$((failed + 1))
+    echo "FEHLGESCHLAGEN: $1 ($2)"
+}
+
+for t in "$dir"/pos/*.cpp "$dir"/neg/*.cpp; do
+    name=${t#"$dir"/}
+    skip=$(sed -n 's|^// SKIP-WITH: *||p' "$t")
+    if [ -n "$skip" ] && [[ " $* " == *" $skip "* ]]; then
+        skipped=$((skipped + 1))
+        continue
+    fi
+    total=$((total + 1))
+    read -r -a args <<< "$(sed -n 's|^// ARGS:||p' "$t")"
+
+    "$bin" "$@" "${args[@]}" "$t" < /dev/null > "$tmp/out" 2> "$tmp/err"
+    rc=$?
+
+    case $name in
+        pos/*)
+            if [ $rc -ne 0 ]; then
+                fail "$name" "Exit-Code $rc: $(head -n 1 "$tmp/err")"
+                continue
+            fi
+            if grep -q '^/\* EXPECT' "$t"; then
+                sed -n '/^\/\* EXPECT/,/^\*\//p' "$t" | sed '1d;$d' > "$tmp/expect"
+                if ! diff -u "$tmp/expect" "$tmp/out" > "$tmp/diff"; then
+                    fail "$name" "Ausgabe weicht ab"
+                    cat "$tmp/diff"
+                fi
+            fi
+            ;;
+        neg/*)
+            if [ $rc -eq 0 ]; then
+                fail "$name" "kein Fehler gemeldet"
+                continue
+            fi
+            exit_code=$(sed -n 's|^// EXIT: *||p' "$t")
+            if [ -n "$exit_code" ] && [ $rc -ne "$exit_code" ]; then
+                fail "$name" "Exit-Code $rc statt $exit_code: $(head -n 1 "$tmp/err")"
+                continue
+            fi
+            expected=$(sed -n 's|^// ERROR: *||p' "$t")
+            if [ -n "$expected" ] && ! grep -qF -- "$expected" "$tmp/err"; then
+                fail "$name" "erwartet '$expected', erhalten: $(head -n 1 "$tmp/err")"
+            fi
+            ;;
+    esac
+done
+
+echo "$((total - failed))/$total Tests bestanden, $skipped übersprungen ($*)"
+[ $failed -eq 0 ]